@@ -0,0 +1,39 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Batch.cpp
+ */
+
+#include "LIDAR-Lite-v3-Batch.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_Batch::LIDAR_Lite_v3_Batch(LIDAR_Lite_v3_Base &device, uint8_t biasInterval)
+	: m_device(device), m_trigger(biasInterval)
+{
+}
+
+bool LIDAR_Lite_v3_Batch::measure(LIDAR_Lite_v3_Measurement &out)
+{
+	m_trigger.fire(m_device);
+	uint8_t status;
+	if (!LIDAR_Lite_v3_Trigger::wait(m_device, status))
+		return false;
+	out.status = status;
+	out.signalStrength = m_device.getSIGNAL_STRENGTH();
+	out.distance = m_device.getFULL_DELAY();
+	return true;
+}
+
+size_t LIDAR_Lite_v3_Batch::readBatch(LIDAR_Lite_v3_Measurement *out, size_t n)
+{
+	size_t i = 0;
+	for (; i < n && measure(out[i]); i++)
+		;
+	return i;
+}
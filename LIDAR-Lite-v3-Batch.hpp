@@ -0,0 +1,135 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Batch.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_BATCH_HPP
+#define LIDAR_LITE_V3_BATCH_HPP
+
+#include <cstddef>
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+
+/* Fixed capacity history buffer, the oldest element is overwritten when full. */
+template <typename T, size_t N>
+class LIDAR_Lite_v3_Ring
+{
+public:
+	LIDAR_Lite_v3_Ring() : m_head(0), m_size(0) {}
+
+	void push(const T &value)
+	{
+		m_data[m_head] = value;
+		m_head = (m_head + 1) % N;
+		if (m_size < N)
+			m_size++;
+	}
+
+	/* Element i, 0 is the oldest */
+	const T &operator[](size_t i) const { return m_data[(m_head + N - m_size + i) % N]; }
+	/* Most recently pushed element, size() must be non-zero */
+	const T &back() const { return m_data[(m_head + N - 1) % N]; }
+
+	size_t size() const { return m_size; }
+	static size_t capacity() { return N; }
+	bool empty() const { return m_size == 0; }
+	void clear() { m_head = 0; m_size = 0; }
+
+private:
+	T m_data[N];
+	size_t m_head;
+	size_t m_size;
+};
+
+/* Fixed capacity FIFO, push fails when full. */
+template <typename T, size_t N>
+class LIDAR_Lite_v3_Queue
+{
+public:
+	LIDAR_Lite_v3_Queue() : m_head(0), m_size(0) {}
+
+	bool push(const T &value)
+	{
+		if (m_size == N)
+			return false;
+		m_data[(m_head + m_size) % N] = value;
+		m_size++;
+		return true;
+	}
+
+	bool pop(T &value)
+	{
+		if (m_size == 0)
+			return false;
+		value = m_data[m_head];
+		m_head = (m_head + 1) % N;
+		m_size--;
+		return true;
+	}
+
+	const T &front() const { return m_data[m_head]; }
+
+	size_t size() const { return m_size; }
+	static size_t capacity() { return N; }
+	bool empty() const { return m_size == 0; }
+	bool full() const { return m_size == N; }
+	void clear() { m_head = 0; m_size = 0; }
+
+private:
+	T m_data[N];
+	size_t m_head;
+	size_t m_size;
+};
+
+/*
+ * Blocking acquisition into caller-owned storage. No heap allocation, exceptions or RTTI.
+ * Receiver bias correction is run on every biasInterval-th command as recommended for ACQ_COMMAND.
+ */
+class LIDAR_Lite_v3_Batch
+{
+public:
+	static const uint16_t BUSY_POLL_LIMIT = LIDAR_Lite_v3_Trigger::BUSY_POLL_LIMIT;
+
+	LIDAR_Lite_v3_Batch(LIDAR_Lite_v3_Base &device, uint8_t biasInterval=100);
+
+	/* Trigger one measurement and read it back. Returns false if the device stayed busy. */
+	bool measure(LIDAR_Lite_v3_Measurement &out);
+
+	/* Fill out[0..n-1], returns the number of measurements taken (less than n on timeout). */
+	size_t readBatch(LIDAR_Lite_v3_Measurement *out, size_t n);
+
+	/* Append up to n measurements to a ring, returns the number taken. */
+	template <size_t N>
+	size_t readBatch(LIDAR_Lite_v3_Ring<LIDAR_Lite_v3_Measurement, N> &ring, size_t n)
+	{
+		LIDAR_Lite_v3_Measurement m;
+		size_t i = 0;
+		for (; i < n && measure(m); i++)
+			ring.push(m);
+		return i;
+	}
+
+	/* Append measurements to a queue until n are taken or the queue is full, returns the number taken. */
+	template <size_t N>
+	size_t readBatch(LIDAR_Lite_v3_Queue<LIDAR_Lite_v3_Measurement, N> &queue, size_t n)
+	{
+		LIDAR_Lite_v3_Measurement m;
+		size_t i = 0;
+		for (; i < n && !queue.full() && measure(m); i++)
+			queue.push(m);
+		return i;
+	}
+
+private:
+	LIDAR_Lite_v3_Base &m_device;
+	LIDAR_Lite_v3_Trigger m_trigger;
+};
+
+#endif /* LIDAR_LITE_V3_BATCH_HPP */
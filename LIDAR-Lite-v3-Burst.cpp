@@ -0,0 +1,165 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Burst.cpp
+ */
+
+#include "LIDAR-Lite-v3-Burst.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+typedef LIDAR_Lite_v3_BurstResult R;
+
+LIDAR_Lite_v3_Burst::LIDAR_Lite_v3_Burst(LIDAR_Lite_v3_Base &device, uint8_t biasInterval)
+	: m_device(device), m_trigger(biasInterval), m_count(1), m_timeoutNs(RESULT_TIMEOUT_NS),
+	  m_saved(false), m_savedConfig(0), m_savedDelay(0), m_savedLoops(0)
+{
+}
+
+bool LIDAR_Lite_v3_Burst::configure(uint8_t count, uint8_t delay)
+{
+	if (count < MIN_COUNT || count > MAX_COUNT)
+		return false;
+	uint8_t config = m_device.getACQ_CONFIG_REG();
+	if (!m_saved)
+	{
+		m_savedConfig = config;
+		m_savedDelay = m_device.getMEASURE_DELAY();
+		m_savedLoops = m_device.getOUTER_LOOP_COUNT();
+		m_saved = true;
+	}
+
+	if (delay)
+	{
+		m_device.setMEASURE_DELAY(delay);
+		config |= B::ACQ_CONFIG_REG::Delay::mask;
+	}
+	else
+		config &= ~B::ACQ_CONFIG_REG::Delay::mask;
+	m_device.setACQ_CONFIG_REG(config);
+	m_device.setOUTER_LOOP_COUNT(count);
+	m_count = count;
+	return true;
+}
+
+void LIDAR_Lite_v3_Burst::restore()
+{
+	if (m_saved)
+	{
+		m_device.setOUTER_LOOP_COUNT(m_savedLoops);
+		m_device.setACQ_CONFIG_REG(m_savedConfig);
+		m_device.setMEASURE_DELAY(m_savedDelay);
+		m_saved = false;
+	}
+	m_count = 1;
+}
+
+uint8_t LIDAR_Lite_v3_Burst::acquire(LIDAR_Lite_v3_Measurement *out)
+{
+	m_trigger.fire(m_device, m_count);
+
+	/* A result is read once per busy period, the ready window after it still shows the same result */
+	uint8_t collected = 0;
+	bool busySeen = false;
+	uint64_t deadline = LIDAR_Lite_v3_Clock::now() + m_timeoutNs;
+	while (collected < m_count && LIDAR_Lite_v3_Clock::now() < deadline)
+	{
+		uint8_t status = m_device.getSTATUS();
+		if (status & B::STATUS::BusyFlag::mask)
+		{
+			busySeen = true;
+			continue;
+		}
+		if (!busySeen)
+			continue;
+
+		LIDAR_Lite_v3_Measurement &m = out[collected++];
+		m.status = status;
+		m.signalStrength = m_device.getSIGNAL_STRENGTH();
+		m.distance = m_device.getFULL_DELAY();
+		busySeen = false;
+		deadline = LIDAR_Lite_v3_Clock::now() + m_timeoutNs;
+	}
+	return collected;
+}
+
+bool LIDAR_Lite_v3_Burst::measure(LIDAR_Lite_v3_BurstResult &result, Estimator estimator, uint8_t trimPercent)
+{
+	uint8_t n = acquire(m_samples);
+	return aggregate(m_samples, n, estimator, trimPercent, result);
+}
+
+bool LIDAR_Lite_v3_Burst::aggregate(const LIDAR_Lite_v3_Measurement *samples, uint8_t n, Estimator estimator, uint8_t trimPercent, LIDAR_Lite_v3_BurstResult &result)
+{
+	uint8_t order[MAX_COUNT];
+	uint8_t used = 0;
+	uint8_t status = 0;
+	uint64_t total = 0;
+	for (uint8_t i = 0; i < n; i++)
+	{
+		status |= samples[i].status;
+		if ((samples[i].status & B::STATUS::InvalidSignalFlag::mask) || samples[i].signalStrength == 0)
+			continue;
+		/* Insertion sort by distance, bursts are short */
+		uint8_t k = used++;
+		while (k > 0 && samples[order[k - 1]].distance > samples[i].distance)
+		{
+			order[k] = order[k - 1];
+			k--;
+		}
+		order[k] = i;
+		total += samples[i].signalStrength;
+	}
+
+	result.samples = n;
+	result.used = used;
+	result.status = status;
+	result.distance = 0;
+	result.spread = 0;
+	if (used == 0)
+		return false;
+	result.spread = samples[order[used - 1]].distance - samples[order[0]].distance;
+
+	if (estimator == MEDIAN || trimPercent >= 50)
+	{
+		/* Weighted median, midway between two samples when the weight splits exactly */
+		uint64_t seen = 0;
+		for (uint8_t k = 0; k < used; k++)
+		{
+			seen += samples[order[k]].signalStrength;
+			if (2 * seen >= total)
+			{
+				uint32_t d = samples[order[k]].distance;
+				if (2 * seen == total && k + 1 < used)
+					result.distance = (d + samples[order[k + 1]].distance) << (R::FRACTION_BITS - 1);
+				else
+					result.distance = d << R::FRACTION_BITS;
+				break;
+			}
+		}
+	}
+	else
+	{
+		/* Weighted trimmed mean: the samples' weight is clipped to the kept band [lo, hi] */
+		uint64_t lo = total * trimPercent / 100, hi = total - lo;
+		uint64_t seen = 0, sum = 0, weight = 0;
+		for (uint8_t k = 0; k < used; k++)
+		{
+			uint64_t w = samples[order[k]].signalStrength;
+			uint64_t a = seen > lo ? seen : lo;
+			uint64_t b = seen + w < hi ? seen + w : hi;
+			if (b > a)
+			{
+				sum += (b - a) * samples[order[k]].distance;
+				weight += b - a;
+			}
+			seen += w;
+		}
+		result.distance = (uint32_t)(((sum << R::FRACTION_BITS) + weight / 2) / weight);
+	}
+	return true;
+}
@@ -0,0 +1,89 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Burst.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_BURST_HPP
+#define LIDAR_LITE_V3_BURST_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+/* Aggregate of one burst */
+struct LIDAR_Lite_v3_BurstResult
+{
+	static const uint8_t FRACTION_BITS = 4;
+
+	uint32_t distance; // 1/16 cm
+	uint16_t spread;   // max - min of the samples used, centimeters
+	uint8_t samples;   // results collected
+	uint8_t used;      // valid samples with a signal, the ones aggregated
+	uint8_t status;    // STATUS flags of all samples, or-ed
+};
+
+/*
+ * Hardware burst acquisition. With OUTER_LOOP_COUNT set the device repeats the measurement on its
+ * own after a single command, MEASURE_DELAY apart when ACQ_CONFIG_REG Delay is set. acquire() issues
+ * one command and reads each result on the busy to ready transition, so the bus carries only STATUS
+ * polls and readouts. A result is lost if polling misses a whole ready window, keep MEASURE_DELAY
+ * long against the poll interval.
+ *
+ * The results are combined with an estimator weighted by SIGNAL_STRENGTH; samples with
+ * InvalidSignalFlag set or no signal are left out.
+ */
+class LIDAR_Lite_v3_Burst
+{
+public:
+	enum Estimator { MEDIAN, TRIMMED_MEAN };
+
+	static const uint8_t MIN_COUNT = 2;
+	static const uint8_t MAX_COUNT = 0xfe;
+	/* Default wait for each result before the burst is cut short, covers the longest MEASURE_DELAY */
+	static const uint64_t RESULT_TIMEOUT_NS = 200000000ull;
+
+	LIDAR_Lite_v3_Burst(LIDAR_Lite_v3_Base &device, uint8_t biasInterval=100);
+
+	/*
+	 * Put the device in burst mode: count repetitions per command, delay in MEASURE_DELAY units
+	 * (0: device default). Saves the registers it changes for restore(). Returns false if count is out of range.
+	 */
+	bool configure(uint8_t count, uint8_t delay=0);
+	/* Back to the saved OUTER_LOOP_COUNT, ACQ_CONFIG_REG and MEASURE_DELAY */
+	void restore();
+
+	uint8_t count() const { return m_count; }
+
+	/* Time allowed for each result, independent of how fast the bus polls */
+	void timeout(uint64_t ns) { m_timeoutNs = ns; }
+	uint64_t timeout() const { return m_timeoutNs; }
+
+	/* Run one burst, out holds count() entries. Returns the number of results collected. */
+	uint8_t acquire(LIDAR_Lite_v3_Measurement *out);
+
+	/* Run one burst and aggregate it, trimPercent is the weight dropped at each end for TRIMMED_MEAN */
+	bool measure(LIDAR_Lite_v3_BurstResult &result, Estimator estimator=MEDIAN, uint8_t trimPercent=25);
+
+	/* Weighted median or trimmed mean of n samples, false if none is usable */
+	static bool aggregate(const LIDAR_Lite_v3_Measurement *samples, uint8_t n, Estimator estimator, uint8_t trimPercent, LIDAR_Lite_v3_BurstResult &result);
+
+private:
+	LIDAR_Lite_v3_Base &m_device;
+	LIDAR_Lite_v3_Trigger m_trigger;
+	uint8_t m_count;
+	uint64_t m_timeoutNs;
+	bool m_saved;
+	uint8_t m_savedConfig;
+	uint8_t m_savedDelay;
+	uint8_t m_savedLoops;
+	LIDAR_Lite_v3_Measurement m_samples[MAX_COUNT];
+};
+
+#endif /* LIDAR_LITE_V3_BURST_HPP */
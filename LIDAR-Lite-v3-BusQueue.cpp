@@ -0,0 +1,393 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-BusQueue.cpp
+ */
+
+#include "LIDAR-Lite-v3-BusQueue.hpp"
+
+#include <cstring>
+#include <sched.h>
+
+LIDAR_Lite_v3_BusQueue::LIDAR_Lite_v3_BusQueue(LIDAR_Lite_v3_Base &bus)
+	: m_bus(bus), m_order(0), m_pending(0), m_running(false), m_stop(false)
+{
+	memset(m_slots, 0, sizeof(m_slots));
+	memset(&m_stats, 0, sizeof(m_stats));
+	pthread_mutex_init(&m_lock, 0);
+	pthread_mutex_init(&m_busLock, 0);
+	pthread_cond_init(&m_changed, 0);
+}
+
+LIDAR_Lite_v3_BusQueue::~LIDAR_Lite_v3_BusQueue()
+{
+	stop();
+	pthread_cond_destroy(&m_changed);
+	pthread_mutex_destroy(&m_busLock);
+	pthread_mutex_destroy(&m_lock);
+}
+
+LIDAR_Lite_v3_BusQueue::Slot *LIDAR_Lite_v3_BusQueue::lookup(Handle handle)
+{
+	uint32_t index = handle & 0xff;
+	if (handle == INVALID || index >= SLOTS)
+		return 0;
+	Slot &slot = m_slots[index];
+	if (slot.state == FREE || slot.generation != (handle >> 16))
+		return 0;
+	return &slot;
+}
+
+bool LIDAR_Lite_v3_BusQueue::isVolatile(uint16_t address, uint8_t length)
+{
+	typedef LIDAR_Lite_v3_Base::REGISTER_INFO Info;
+	for (uint8_t i = 0; i < LIDAR_Lite_v3_Base::REGISTER_COUNT; i++)
+	{
+		const Info &r = LIDAR_Lite_v3_Base::REGISTERS[i];
+		if ((r.flags & Info::VOLATILE) && address + length > r.address && address < r.address + r.width / 8)
+			return true;
+	}
+	return false;
+}
+
+/* A queued write overlaps [lo, hi), reads of that range must not move past it */
+bool LIDAR_Lite_v3_BusQueue::writePending(uint16_t lo, uint16_t hi) const
+{
+	for (uint8_t i = 0; i < SLOTS; i++)
+	{
+		const Slot &s = m_slots[i];
+		if (s.state == PENDING && (s.kind == WRITE8 || s.kind == WRITE16) && s.address < hi && s.address + s.length > lo)
+			return true;
+	}
+	return false;
+}
+
+/* Oldest queued write overlapping slot and queued before it, 0 if none */
+LIDAR_Lite_v3_BusQueue::Slot *LIDAR_Lite_v3_BusQueue::olderWrite(const Slot &slot)
+{
+	Slot *oldest = 0;
+	for (uint8_t i = 0; i < SLOTS; i++)
+	{
+		Slot &s = m_slots[i];
+		if (s.state == PENDING && (s.kind == WRITE8 || s.kind == WRITE16) && s.order < slot.order
+			&& s.address < slot.address + slot.length && s.address + s.length > slot.address && (!oldest || s.order < oldest->order))
+			oldest = &s;
+	}
+	return oldest;
+}
+
+LIDAR_Lite_v3_BusQueue::Handle LIDAR_Lite_v3_BusQueue::submit(uint8_t kind, uint16_t address, uint8_t length, uint16_t value, uint8_t priority)
+{
+	if (length == 0 || length > MAX_BURST)
+		return INVALID;
+	if (priority >= PRIORITIES)
+		priority = PRIORITIES - 1;
+
+	pthread_mutex_lock(&m_lock);
+	m_stats.submitted++;
+
+	/* A command register acts on every write, only configuration values may be replaced */
+	if ((kind == WRITE8 || kind == WRITE16) && !isVolatile(address, length))
+	{
+		/* Latest queued transaction touching this register */
+		Slot *latest = 0;
+		for (uint8_t i = 0; i < SLOTS; i++)
+		{
+			Slot &s = m_slots[i];
+			if (s.state == PENDING && address + length > s.address && address < s.address + s.length && (!latest || s.order > latest->order))
+				latest = &s;
+		}
+		if (latest && latest->kind == kind && latest->address == address)
+		{
+			/* Keep the queued priority, moving it would reorder it against other transactions */
+			latest->value = value;
+			latest->refs++;
+			m_stats.collapsedWrites++;
+			Handle handle = (Handle)latest->generation << 16 | (Handle)(latest - m_slots);
+			pthread_mutex_unlock(&m_lock);
+			return handle;
+		}
+	}
+
+	for (;;)
+	{
+		for (uint8_t i = 0; i < SLOTS; i++)
+		{
+			Slot &s = m_slots[i];
+			if (s.state != FREE)
+				continue;
+			s.state = PENDING;
+			s.kind = kind;
+			s.priority = priority;
+			s.length = length;
+			s.address = address;
+			s.value = value;
+			s.refs = 1;
+			s.mergeable = kind == READ && !isVolatile(address, length);
+			s.generation++;
+			s.order = m_order++;
+			m_pending++;
+			Handle handle = (Handle)s.generation << 16 | i;
+			pthread_cond_broadcast(&m_changed);
+			pthread_mutex_unlock(&m_lock);
+			return handle;
+		}
+
+		/* All slots in use: let the worker drain, or drain on this thread */
+		if (m_running)
+			pthread_cond_wait(&m_changed, &m_lock);
+		else
+		{
+			pthread_mutex_unlock(&m_lock);
+			if (!pump())
+				sched_yield();
+			pthread_mutex_lock(&m_lock);
+		}
+	}
+}
+
+LIDAR_Lite_v3_BusQueue::Handle LIDAR_Lite_v3_BusQueue::read(uint16_t address, uint8_t length, uint8_t priority)
+{
+	return submit(READ, address, length, 0, priority);
+}
+
+LIDAR_Lite_v3_BusQueue::Handle LIDAR_Lite_v3_BusQueue::read16(uint16_t address, uint8_t priority)
+{
+	return submit(READ16, address, 2, 0, priority);
+}
+
+LIDAR_Lite_v3_BusQueue::Handle LIDAR_Lite_v3_BusQueue::write(uint16_t address, uint8_t value, uint8_t priority)
+{
+	return submit(WRITE8, address, 1, value, priority);
+}
+
+LIDAR_Lite_v3_BusQueue::Handle LIDAR_Lite_v3_BusQueue::write16(uint16_t address, uint16_t value, uint8_t priority)
+{
+	return submit(WRITE16, address, 2, value, priority);
+}
+
+bool LIDAR_Lite_v3_BusQueue::poll(Handle handle, uint8_t *data)
+{
+	pthread_mutex_lock(&m_lock);
+	Slot *slot = lookup(handle);
+	bool done = !slot || slot->state == DONE;
+	if (slot && done)
+	{
+		if (data && (slot->kind == READ || slot->kind == READ16))
+			memcpy(data, slot->data, slot->length);
+		if (--slot->refs == 0)
+		{
+			slot->state = FREE;
+			pthread_cond_broadcast(&m_changed);
+		}
+	}
+	pthread_mutex_unlock(&m_lock);
+	return done;
+}
+
+void LIDAR_Lite_v3_BusQueue::wait(Handle handle, uint8_t *data)
+{
+	pthread_mutex_lock(&m_lock);
+	for (;;)
+	{
+		Slot *slot = lookup(handle);
+		if (!slot || slot->state == DONE)
+			break;
+		if (m_running)
+			pthread_cond_wait(&m_changed, &m_lock);
+		else
+		{
+			pthread_mutex_unlock(&m_lock);
+			bool pumped = pump();
+			pthread_mutex_lock(&m_lock);
+			/* Nothing left to pump, another thread is executing our transaction */
+			slot = lookup(handle);
+			if (!pumped && slot && slot->state != DONE)
+				pthread_cond_wait(&m_changed, &m_lock);
+		}
+	}
+	pthread_mutex_unlock(&m_lock);
+	poll(handle, data);
+}
+
+bool LIDAR_Lite_v3_BusQueue::pump()
+{
+	pthread_mutex_lock(&m_lock);
+	Slot *first = 0;
+	for (uint8_t i = 0; i < SLOTS; i++)
+	{
+		Slot &s = m_slots[i];
+		if (s.state == PENDING && (!first || s.priority < first->priority || (s.priority == first->priority && s.order < first->order)))
+			first = &s;
+	}
+	if (!first)
+	{
+		pthread_mutex_unlock(&m_lock);
+		return false;
+	}
+	/* Read after write and write after write: older overlapping writes go first, order only decreases */
+	for (Slot *older = olderWrite(*first); older; older = olderWrite(*first))
+		first = older;
+
+	Slot *batch[SLOTS];
+	uint8_t count = 0;
+	batch[count++] = first;
+	first->state = ACTIVE;
+	uint16_t lo = first->address, hi = first->address + first->length;
+
+	/* Grow the burst with adjacent or overlapping reads of the same priority */
+	for (bool grown = first->mergeable; grown; )
+	{
+		grown = false;
+		for (uint8_t i = 0; i < SLOTS; i++)
+		{
+			Slot &s = m_slots[i];
+			if (s.state != PENDING || !s.mergeable || s.priority != first->priority)
+				continue;
+			uint16_t end = s.address + s.length;
+			if (s.address > hi || end < lo)
+				continue;
+			uint16_t newLo = s.address < lo ? s.address : lo;
+			uint16_t newHi = end > hi ? end : hi;
+			if (newHi - newLo > MAX_BURST || writePending(newLo, newHi))
+				continue;
+			lo = newLo;
+			hi = newHi;
+			s.state = ACTIVE;
+			batch[count++] = &s;
+			grown = true;
+		}
+	}
+	m_pending -= count;
+	pthread_mutex_unlock(&m_lock);
+
+	uint8_t buffer[MAX_BURST];
+	pthread_mutex_lock(&m_busLock);
+	if (first->kind == READ)
+		m_bus.readBurst(lo, buffer, hi - lo);
+	else if (first->kind == READ16)
+	{
+		uint16_t value = m_bus.read16(first->address, 16);
+		buffer[0] = (uint8_t)(value >> 8);
+		buffer[1] = (uint8_t)value;
+	}
+	else if (first->kind == WRITE8)
+		m_bus.write(first->address, (uint8_t)first->value, 8);
+	else
+		m_bus.write(first->address, first->value, 16);
+	pthread_mutex_unlock(&m_busLock);
+
+	pthread_mutex_lock(&m_lock);
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (batch[i]->kind == READ || batch[i]->kind == READ16)
+			memcpy(batch[i]->data, buffer + (batch[i]->address - lo), batch[i]->length);
+		batch[i]->state = DONE;
+	}
+	m_stats.transfers++;
+	m_stats.mergedReads += count - 1;
+	pthread_cond_broadcast(&m_changed);
+	pthread_mutex_unlock(&m_lock);
+	return true;
+}
+
+void *LIDAR_Lite_v3_BusQueue::run(void *arg)
+{
+	LIDAR_Lite_v3_BusQueue &self = *(LIDAR_Lite_v3_BusQueue *)arg;
+	pthread_mutex_lock(&self.m_lock);
+	while (!self.m_stop)
+	{
+		if (self.m_pending == 0)
+		{
+			pthread_cond_wait(&self.m_changed, &self.m_lock);
+			continue;
+		}
+		pthread_mutex_unlock(&self.m_lock);
+		self.pump();
+		pthread_mutex_lock(&self.m_lock);
+	}
+	pthread_mutex_unlock(&self.m_lock);
+	return 0;
+}
+
+bool LIDAR_Lite_v3_BusQueue::start()
+{
+	pthread_mutex_lock(&m_lock);
+	bool ok = !m_running;
+	if (ok)
+	{
+		m_stop = false;
+		m_running = pthread_create(&m_thread, 0, run, this) == 0;
+		ok = m_running;
+	}
+	pthread_mutex_unlock(&m_lock);
+	return ok;
+}
+
+void LIDAR_Lite_v3_BusQueue::stop()
+{
+	pthread_mutex_lock(&m_lock);
+	if (!m_running)
+	{
+		pthread_mutex_unlock(&m_lock);
+		return;
+	}
+	m_stop = true;
+	pthread_cond_broadcast(&m_changed);
+	pthread_mutex_unlock(&m_lock);
+	pthread_join(m_thread, 0);
+
+	pthread_mutex_lock(&m_lock);
+	m_running = false;
+	pthread_cond_broadcast(&m_changed);
+	pthread_mutex_unlock(&m_lock);
+}
+
+LIDAR_Lite_v3_BusQueue::Stats LIDAR_Lite_v3_BusQueue::stats() const
+{
+	pthread_mutex_lock(&m_lock);
+	Stats stats = m_stats;
+	pthread_mutex_unlock(&m_lock);
+	return stats;
+}
+
+uint8_t LIDAR_Lite_v3_QueuedDevice::read8(uint16_t address, uint16_t)
+{
+	uint8_t data;
+	m_queue.wait(m_queue.read(address, 1, m_priority), &data);
+	return data;
+}
+
+void LIDAR_Lite_v3_QueuedDevice::write(uint16_t address, uint8_t value, uint16_t)
+{
+	m_queue.wait(m_queue.write(address, value, m_priority));
+}
+
+uint16_t LIDAR_Lite_v3_QueuedDevice::read16(uint16_t address, uint16_t)
+{
+	uint8_t data[2];
+	m_queue.wait(m_queue.read16(address, m_priority), data);
+	return (uint16_t)(data[0] << 8 | data[1]);
+}
+
+void LIDAR_Lite_v3_QueuedDevice::write(uint16_t address, uint16_t value, uint16_t)
+{
+	m_queue.wait(m_queue.write16(address, value, m_priority));
+}
+
+void LIDAR_Lite_v3_QueuedDevice::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	while (count)
+	{
+		uint8_t n = count > LIDAR_Lite_v3_BusQueue::MAX_BURST ? (uint8_t)LIDAR_Lite_v3_BusQueue::MAX_BURST : (uint8_t)count;
+		m_queue.wait(m_queue.read(address, n, m_priority), data);
+		address += n;
+		data += n;
+		count -= n;
+	}
+}
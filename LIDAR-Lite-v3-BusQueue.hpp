@@ -0,0 +1,147 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-BusQueue.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_BUSQUEUE_HPP
+#define LIDAR_LITE_V3_BUSQUEUE_HPP
+
+#include <pthread.h>
+#include "LIDAR-Lite-v3.hpp"
+
+/*
+ * Prioritized asynchronous transaction queue in front of a LIDAR_Lite_v3_Base transport.
+ *
+ * Transactions are executed highest priority first, oldest first within a priority, but never
+ * ahead of an older queued write to an overlapping register: that write is promoted and executed
+ * first. A read therefore always returns the values of the writes queued before it, and writes to
+ * one register land in the order they were queued.
+ *
+ * When a read is dispatched, queued reads of the same priority at adjacent or overlapping addresses
+ * are merged into one readBurst(), unless they cover a VOLATILE register (CORR_DATA advances on
+ * every read) or a queued write overlaps the burst. A write to a non-VOLATILE register that already
+ * has a queued write, with no queued read of that register after it, replaces the queued value
+ * instead of adding a transaction; the queued write keeps its priority. Writes to command registers
+ * such as ACQ_COMMAND are never collapsed, every one reaches the bus.
+ *
+ * Transactions are executed by a worker thread (start()) or by whichever caller runs pump() or
+ * waits for a completion. Slots are preallocated, submit blocks while all are in use. Every
+ * handle must be released with poll() or wait().
+ */
+class LIDAR_Lite_v3_BusQueue
+{
+public:
+	/* Priorities, lower is more urgent */
+	static const uint8_t PRIORITY_DISTANCE = 0;
+	static const uint8_t PRIORITY_CONTROL = 1;
+	static const uint8_t PRIORITY_CONFIG = 2;
+	static const uint8_t PRIORITY_DIAGNOSTIC = 3;
+	static const uint8_t PRIORITIES = 4;
+
+	static const uint8_t SLOTS = 32;
+	static const uint8_t MAX_BURST = 32;
+
+	typedef uint32_t Handle;
+	static const Handle INVALID = 0xffffffff;
+
+	struct Stats
+	{
+		uint64_t submitted;
+		uint64_t transfers;      // bus transactions issued
+		uint64_t mergedReads;    // reads served by another read's burst
+		uint64_t collapsedWrites; // writes folded into a queued write
+	};
+
+	LIDAR_Lite_v3_BusQueue(LIDAR_Lite_v3_Base &bus);
+	~LIDAR_Lite_v3_BusQueue();
+
+	/* Queue a read of length consecutive registers (at most MAX_BURST) */
+	Handle read(uint16_t address, uint8_t length, uint8_t priority);
+	/* Queue a 16 bit read through the transport's read16(), data is high byte first */
+	Handle read16(uint16_t address, uint8_t priority);
+	/* Queue an 8 bit write */
+	Handle write(uint16_t address, uint8_t value, uint8_t priority);
+	/* Queue a 16 bit write */
+	Handle write16(uint16_t address, uint16_t value, uint8_t priority);
+
+	/* True once the transaction completed, copies read data and releases the handle */
+	bool poll(Handle handle, uint8_t *data=0);
+	/* Block until the transaction completed, then as poll() */
+	void wait(Handle handle, uint8_t *data=0);
+
+	/* Execute one dispatch unit on the calling thread, returns false if nothing was pending */
+	bool pump();
+
+	/* Run a worker thread that pumps whenever work is queued */
+	bool start();
+	void stop();
+
+	Stats stats() const;
+
+private:
+	LIDAR_Lite_v3_BusQueue(const LIDAR_Lite_v3_BusQueue &);
+	LIDAR_Lite_v3_BusQueue &operator=(const LIDAR_Lite_v3_BusQueue &);
+
+	enum State { FREE, PENDING, ACTIVE, DONE };
+	enum Kind { READ, READ16, WRITE8, WRITE16 };
+
+	struct Slot
+	{
+		uint8_t state;
+		uint8_t kind;
+		uint8_t priority;
+		uint8_t length;
+		uint8_t refs; // handles not yet polled, more than one for collapsed writes
+		bool mergeable; // a READ that covers no VOLATILE register
+		uint16_t address;
+		uint16_t value;
+		uint16_t generation;
+		uint64_t order;
+		uint8_t data[MAX_BURST];
+	};
+
+	Handle submit(uint8_t kind, uint16_t address, uint8_t length, uint16_t value, uint8_t priority);
+	Slot *lookup(Handle handle);
+	bool writePending(uint16_t lo, uint16_t hi) const;
+	Slot *olderWrite(const Slot &slot);
+	static bool isVolatile(uint16_t address, uint8_t length);
+	static void *run(void *arg);
+
+	LIDAR_Lite_v3_Base &m_bus;
+	Slot m_slots[SLOTS];
+	uint64_t m_order;
+	uint8_t m_pending;
+	Stats m_stats;
+
+	mutable pthread_mutex_t m_lock;
+	pthread_mutex_t m_busLock;
+	pthread_cond_t m_changed;
+	pthread_t m_thread;
+	bool m_running;
+	bool m_stop;
+};
+
+/* LIDAR_Lite_v3_Base view of a queue at a fixed priority, the register accessors block until completion */
+class LIDAR_Lite_v3_QueuedDevice : public LIDAR_Lite_v3_Base
+{
+public:
+	LIDAR_Lite_v3_QueuedDevice(LIDAR_Lite_v3_BusQueue &queue, uint8_t priority) : m_queue(queue), m_priority(priority) {}
+
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	uint16_t read16(uint16_t address, uint16_t n=16);
+	void write(uint16_t address, uint16_t value, uint16_t n=16);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+
+private:
+	LIDAR_Lite_v3_BusQueue &m_queue;
+	uint8_t m_priority;
+};
+
+#endif /* LIDAR_LITE_V3_BUSQUEUE_HPP */
@@ -0,0 +1,42 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Calibration.cpp
+ */
+
+#include "LIDAR-Lite-v3-Calibration.hpp"
+
+/* Two zero knots, used when no table matches so apply() stays branch free */
+const LIDAR_Lite_v3_CalibrationTable LIDAR_Lite_v3_Calibration::IDENTITY = { 0, 0, 12, 2, { 0, 0 } };
+
+LIDAR_Lite_v3_Calibration::LIDAR_Lite_v3_Calibration(const LIDAR_Lite_v3_CalibrationTable *tables, uint8_t count)
+	: m_tables(tables), m_count(count), m_table(&IDENTITY)
+{
+}
+
+bool LIDAR_Lite_v3_Calibration::select(uint16_t unitId)
+{
+	typedef LIDAR_Lite_v3_CalibrationTable T;
+	for (uint8_t i = 0; i < m_count; i++)
+	{
+		const T &t = m_tables[i];
+		if (t.unitId == unitId && t.count >= 2 && t.count <= T::MAX_KNOTS && t.shift <= T::MAX_SHIFT)
+		{
+			m_table = &m_tables[i];
+			return true;
+		}
+	}
+	m_table = &IDENTITY;
+	return false;
+}
+
+bool LIDAR_Lite_v3_Calibration::select(LIDAR_Lite_v3_Base &device)
+{
+	uint16_t unitId = (uint16_t)(device.getUNIT_ID_HIGH() << 8 | device.getUNIT_ID_LOW());
+	return select(unitId);
+}
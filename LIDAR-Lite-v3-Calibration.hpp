@@ -0,0 +1,117 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Calibration.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_CALIBRATION_HPP
+#define LIDAR_LITE_V3_CALIBRATION_HPP
+
+#include <cstddef>
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+
+/*
+ * Range dependent correction for one unit. Knot i sits at FULL_DELAY origin + (i << shift)
+ * and holds the correction to add in 1/16 cm. Distances outside the knots use the end values.
+ */
+struct LIDAR_Lite_v3_CalibrationTable
+{
+	static const uint8_t MAX_KNOTS = 64;
+	static const uint8_t FRACTION_BITS = 4;
+	static const uint8_t MAX_SHIFT = 12; // keeps (b - a) * frac within 32 bits for any int16 knots
+
+	uint16_t unitId; // UNIT_ID_HIGH << 8 | UNIT_ID_LOW
+	uint16_t origin; // centimeters
+	uint8_t shift;   // knot spacing is 1 << shift centimeters, at most MAX_SHIFT
+	uint8_t count;   // knots in use, at least 2
+	int16_t offset[MAX_KNOTS];
+};
+
+/*
+ * Per unit calibration. Tables are owned by the caller (they may live in flash), select() picks
+ * the one matching the unit. The interpolation kernel is integer only and branch free, so it runs
+ * on FPU-less targets and the batch loop vectorizes on the host.
+ */
+class LIDAR_Lite_v3_Calibration
+{
+public:
+	LIDAR_Lite_v3_Calibration(const LIDAR_Lite_v3_CalibrationTable *tables, uint8_t count);
+
+	/*
+	 * Select the table for a unit, returns false and applies no correction if there is none.
+	 * Tables with fewer than 2 or more than MAX_KNOTS knots or a shift above MAX_SHIFT are skipped.
+	 */
+	bool select(uint16_t unitId);
+	/* Read UNIT_ID_HIGH/LOW from the device and select its table */
+	bool select(LIDAR_Lite_v3_Base &device);
+
+	const LIDAR_Lite_v3_CalibrationTable *selected() const { return m_table == &IDENTITY ? 0 : m_table; }
+
+	/* Corrected distance in centimeters, rounded and saturated to 0..65535 */
+	uint16_t apply(uint16_t distance) const
+	{
+		const LIDAR_Lite_v3_CalibrationTable &t = *m_table;
+		return correct(t.offset, t.origin, t.shift, t.count, distance);
+	}
+
+	/*
+	 * Correct n distances in place. The knots are widened into a local array, which cannot alias
+	 * the data and allows 32 bit gathers, so the loop vectorizes.
+	 */
+	void apply(uint16_t *distance, size_t n) const
+	{
+		const LIDAR_Lite_v3_CalibrationTable &t = *m_table;
+		int32_t offset[LIDAR_Lite_v3_CalibrationTable::MAX_KNOTS];
+		for (uint8_t k = 0; k < t.count; k++)
+			offset[k] = t.offset[k];
+		int32_t origin = t.origin, shift = t.shift, count = t.count;
+		for (size_t i = 0; i < n; i++)
+			distance[i] = correct(offset, origin, shift, count, distance[i]);
+	}
+
+	/* Correct the distance of n measurements in place */
+	void apply(LIDAR_Lite_v3_Measurement *measurement, size_t n) const
+	{
+		const LIDAR_Lite_v3_CalibrationTable &t = *m_table;
+		int32_t offset[LIDAR_Lite_v3_CalibrationTable::MAX_KNOTS];
+		for (uint8_t k = 0; k < t.count; k++)
+			offset[k] = t.offset[k];
+		int32_t origin = t.origin, shift = t.shift, count = t.count;
+		for (size_t i = 0; i < n; i++)
+			measurement[i].distance = correct(offset, origin, shift, count, measurement[i].distance);
+	}
+
+private:
+	template <typename O>
+	static uint16_t correct(const O *offset, int32_t origin, int32_t shift, int32_t count, uint16_t distance)
+	{
+		int32_t last = (count - 1) << shift;
+		int32_t x = (int32_t)distance - origin;
+		x = x < 0 ? 0 : x;
+		x = x > last ? last : x;
+		int32_t i = x >> shift;
+		i = i > count - 2 ? count - 2 : i;
+		int32_t frac = x - (i << shift);
+		int32_t a = offset[i], b = offset[i + 1];
+		int32_t correction = a + (((b - a) * frac) >> shift);
+		int32_t result = (((int32_t)distance << LIDAR_Lite_v3_CalibrationTable::FRACTION_BITS) + correction
+			+ (1 << (LIDAR_Lite_v3_CalibrationTable::FRACTION_BITS - 1))) >> LIDAR_Lite_v3_CalibrationTable::FRACTION_BITS;
+		result = result < 0 ? 0 : result;
+		result = result > 0xffff ? 0xffff : result;
+		return (uint16_t)result;
+	}
+
+	static const LIDAR_Lite_v3_CalibrationTable IDENTITY;
+
+	const LIDAR_Lite_v3_CalibrationTable *m_tables;
+	uint8_t m_count;
+	const LIDAR_Lite_v3_CalibrationTable *m_table;
+};
+
+#endif /* LIDAR_LITE_V3_CALIBRATION_HPP */
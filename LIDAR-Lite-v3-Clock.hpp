@@ -0,0 +1,42 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Clock.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_CLOCK_HPP
+#define LIDAR_LITE_V3_CLOCK_HPP
+
+#include <cinttypes>
+#include <time.h>
+
+/* Monotonic time source shared by the helper classes. All times are in nanoseconds. */
+struct LIDAR_Lite_v3_Clock
+{
+	/* Current CLOCK_MONOTONIC time */
+	static uint64_t now()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+	}
+
+	/* Current CLOCK_MONOTONIC_RAW time, not slewed by NTP, where available */
+	static uint64_t raw()
+	{
+#ifdef CLOCK_MONOTONIC_RAW
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+		return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#else
+		return now();
+#endif
+	}
+};
+
+#endif /* LIDAR_LITE_V3_CLOCK_HPP */
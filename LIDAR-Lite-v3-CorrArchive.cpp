@@ -0,0 +1,311 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-CorrArchive.cpp
+ */
+
+#include "LIDAR-Lite-v3-CorrArchive.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char MAGIC[8] = { 'L', 'L', 'V', '3', 'C', 'O', 'R', 'R' };
+
+static size_t align64(size_t n)
+{
+	return (n + 63) & ~(size_t)63;
+}
+
+LIDAR_Lite_v3_CorrArchive::LIDAR_Lite_v3_CorrArchive()
+	: m_base(0), m_size(0), m_writable(false), m_header(0), m_unitIds(0), m_settings(0), m_records(0)
+{
+}
+
+LIDAR_Lite_v3_CorrArchive::~LIDAR_Lite_v3_CorrArchive()
+{
+	close();
+}
+
+size_t LIDAR_Lite_v3_CorrArchive::fileSize(uint64_t capacity)
+{
+	return align64(sizeof(Header))
+		+ align64(capacity * sizeof(uint16_t))
+		+ align64(capacity * sizeof(LIDAR_Lite_v3_CorrSettings))
+		+ capacity * RECORD_SIZE * sizeof(int16_t);
+}
+
+bool LIDAR_Lite_v3_CorrArchive::map(int fd, size_t size, bool writable)
+{
+	void *base = mmap(0, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (base == MAP_FAILED)
+		return false;
+
+	m_base = base;
+	m_size = size;
+	m_writable = writable;
+	m_header = (Header *)base;
+	return true;
+}
+
+void LIDAR_Lite_v3_CorrArchive::layout()
+{
+	uint64_t capacity = m_header->capacity;
+	char *p = (char *)m_base + align64(sizeof(Header));
+	m_unitIds = (uint16_t *)p;
+	p += align64(capacity * sizeof(uint16_t));
+	m_settings = (LIDAR_Lite_v3_CorrSettings *)p;
+	p += align64(capacity * sizeof(LIDAR_Lite_v3_CorrSettings));
+	m_records = (int16_t *)p;
+}
+
+bool LIDAR_Lite_v3_CorrArchive::create(const char *path, uint64_t capacity)
+{
+	close();
+	int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return false;
+	size_t size = fileSize(capacity);
+	if (ftruncate(fd, size) != 0)
+	{
+		::close(fd);
+		return false;
+	}
+	if (!map(fd, size, true))
+		return false;
+
+	memcpy(m_header->magic, MAGIC, sizeof(MAGIC));
+	m_header->version = VERSION;
+	m_header->recordSize = RECORD_SIZE;
+	m_header->capacity = capacity;
+	m_header->count = 0;
+	layout();
+	return true;
+}
+
+bool LIDAR_Lite_v3_CorrArchive::open(const char *path)
+{
+	close();
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(Header))
+	{
+		::close(fd);
+		return false;
+	}
+	if (!map(fd, st.st_size, false))
+		return false;
+
+	/* Bound capacity by the file before fileSize() multiplies it, a corrupt header must not wrap */
+	const size_t perRecord = sizeof(uint16_t) + sizeof(LIDAR_Lite_v3_CorrSettings) + RECORD_SIZE * sizeof(int16_t);
+	if (memcmp(m_header->magic, MAGIC, sizeof(MAGIC)) != 0 || m_header->version != VERSION
+		|| m_header->recordSize != RECORD_SIZE || m_header->capacity > m_size / perRecord
+		|| fileSize(m_header->capacity) > m_size
+		|| m_header->count > m_header->capacity)
+	{
+		close();
+		return false;
+	}
+	layout();
+	return true;
+}
+
+void LIDAR_Lite_v3_CorrArchive::close()
+{
+	if (m_base)
+		munmap(m_base, m_size);
+	m_base = 0;
+	m_size = 0;
+	m_writable = false;
+	m_header = 0;
+	m_unitIds = 0;
+	m_settings = 0;
+	m_records = 0;
+}
+
+bool LIDAR_Lite_v3_CorrArchive::append(uint16_t unitId, const LIDAR_Lite_v3_CorrSettings &settings, const int16_t *record)
+{
+	if (!m_writable || m_header->count >= m_header->capacity)
+		return false;
+	uint64_t i = m_header->count;
+	m_unitIds[i] = unitId;
+	m_settings[i] = settings;
+	memcpy(m_records + i * RECORD_SIZE, record, RECORD_SIZE * sizeof(int16_t));
+	m_header->count = i + 1;
+	return true;
+}
+
+bool LIDAR_Lite_v3_CorrArchive::capture(LIDAR_Lite_v3_Base &device)
+{
+	if (!m_writable || m_header->count >= m_header->capacity)
+		return false;
+	uint16_t unitId = (uint16_t)(device.getUNIT_ID_HIGH() << 8 | device.getUNIT_ID_LOW());
+	LIDAR_Lite_v3_CorrSettings settings;
+	settings.sigCountVal = device.getSIG_COUNT_VAL();
+	settings.acqConfigReg = device.getACQ_CONFIG_REG();
+	settings.refCountVal = device.getREF_COUNT_VAL();
+	settings.thresholdBypass = device.getTHRESHOLD_BYPASS();
+	int16_t record[RECORD_SIZE];
+	LIDAR_Lite_v3_MultiReturn::readRecord(device, record);
+	return append(unitId, settings, record);
+}
+
+void LIDAR_Lite_v3_CorrAnalytics::analyze(const int16_t *record, const int16_t *tmpl, LIDAR_Lite_v3_CorrResult &out)
+{
+	const uint16_t N = LIDAR_Lite_v3_CorrArchive::RECORD_SIZE;
+
+	uint16_t peak = 0;
+	for (uint16_t i = 1; i < N; i++)
+		if (record[i] > record[peak])
+			peak = i;
+	int32_t half = record[peak] / 2;
+
+	/* Straight reductions, kept branch free so they vectorize */
+	int32_t sumSq = 0, dot = 0, tmplSq = 0;
+	for (uint16_t i = 0; i < N; i++)
+	{
+		int32_t r = record[i], t = tmpl[i];
+		sumSq += r * r;
+		dot += r * t;
+		tmplSq += t * t;
+	}
+
+	/* Width of the contiguous lobe around the peak only, a second return does not widen it */
+	uint16_t left = peak, right = peak;
+	while (left > 0 && record[left - 1] >= half)
+		left--;
+	while (right < N - 1 && record[right + 1] >= half)
+		right++;
+
+	uint16_t lo = peak > PEAK_GUARD ? peak - PEAK_GUARD : 0;
+	uint16_t hi = peak + PEAK_GUARD < N ? peak + PEAK_GUARD : N - 1;
+	int32_t lobeSq = 0;
+	for (uint16_t i = lo; i <= hi; i++)
+		lobeSq += (int32_t)record[i] * record[i];
+	int32_t outside = N - (hi - lo + 1);
+
+	out.peakIndex = peak;
+	out.peakWidth = right - left + 1;
+	out.noiseFloor = outside > 0 ? (float)std::sqrt((double)(sumSq - lobeSq) / outside) : 0.0f;
+	out.match = sumSq > 0 && tmplSq > 0 ? (float)(dot / std::sqrt((double)sumSq * tmplSq)) : 0.0f;
+}
+
+struct CorrJob
+{
+	const LIDAR_Lite_v3_CorrArchive *archive;
+	const int16_t *tmpl;
+	uint64_t begin;
+	uint64_t end;
+	LIDAR_Lite_v3_CorrResult *results;
+	LIDAR_Lite_v3_CorrSummary partial; // sums, divided when merged
+};
+
+static void *corrWorker(void *arg)
+{
+	CorrJob &job = *(CorrJob *)arg;
+	LIDAR_Lite_v3_CorrSummary &s = job.partial;
+	for (uint64_t i = job.begin; i < job.end; i++)
+	{
+		LIDAR_Lite_v3_CorrResult r;
+		LIDAR_Lite_v3_CorrAnalytics::analyze(job.archive->record(i), job.tmpl, r);
+		if (job.results)
+			job.results[i] = r;
+		s.records++;
+		s.noiseFloorMean += r.noiseFloor;
+		if (r.noiseFloor > s.noiseFloorMax)
+			s.noiseFloorMax = r.noiseFloor;
+		s.peakWidthMean += r.peakWidth;
+		if (r.peakWidth < s.peakWidthMin)
+			s.peakWidthMin = r.peakWidth;
+		if (r.peakWidth > s.peakWidthMax)
+			s.peakWidthMax = r.peakWidth;
+		s.matchMean += r.match;
+		if (r.match < s.matchMin)
+			s.matchMin = r.match;
+	}
+	return 0;
+}
+
+static void clearSummary(LIDAR_Lite_v3_CorrSummary &s)
+{
+	s.records = 0;
+	s.noiseFloorMean = 0;
+	s.noiseFloorMax = 0;
+	s.peakWidthMean = 0;
+	s.peakWidthMin = 0xffff;
+	s.peakWidthMax = 0;
+	s.matchMean = 0;
+	s.matchMin = 1;
+}
+
+bool LIDAR_Lite_v3_CorrAnalytics::run(const LIDAR_Lite_v3_CorrArchive &archive, const int16_t *tmpl, unsigned threads,
+	LIDAR_Lite_v3_CorrSummary &summary, LIDAR_Lite_v3_CorrResult *results)
+{
+	uint64_t count = archive.count();
+	if (threads == 0)
+		threads = 1;
+	if (threads > count)
+		threads = count ? (unsigned)count : 1;
+
+	std::vector<CorrJob> jobs(threads);
+	std::vector<pthread_t> ids(threads);
+	std::vector<bool> started(threads, false);
+	for (unsigned t = 0; t < threads; t++)
+	{
+		CorrJob &job = jobs[t];
+		job.archive = &archive;
+		job.tmpl = tmpl;
+		job.begin = count * t / threads;
+		job.end = count * (t + 1) / threads;
+		job.results = results;
+		clearSummary(job.partial);
+		started[t] = t > 0 && pthread_create(&ids[t], 0, corrWorker, &job) == 0;
+	}
+
+	/* Thread 0, and any thread that failed to start, runs on the caller */
+	bool ok = true;
+	for (unsigned t = 0; t < threads; t++)
+		if (!started[t])
+			corrWorker(&jobs[t]);
+	for (unsigned t = 0; t < threads; t++)
+		if (started[t] && pthread_join(ids[t], 0) != 0)
+			ok = false;
+
+	clearSummary(summary);
+	for (unsigned t = 0; t < threads; t++)
+	{
+		const LIDAR_Lite_v3_CorrSummary &p = jobs[t].partial;
+		summary.records += p.records;
+		summary.noiseFloorMean += p.noiseFloorMean;
+		summary.peakWidthMean += p.peakWidthMean;
+		summary.matchMean += p.matchMean;
+		if (p.noiseFloorMax > summary.noiseFloorMax)
+			summary.noiseFloorMax = p.noiseFloorMax;
+		if (p.peakWidthMin < summary.peakWidthMin)
+			summary.peakWidthMin = p.peakWidthMin;
+		if (p.peakWidthMax > summary.peakWidthMax)
+			summary.peakWidthMax = p.peakWidthMax;
+		if (p.matchMin < summary.matchMin)
+			summary.matchMin = p.matchMin;
+	}
+	if (summary.records)
+	{
+		summary.noiseFloorMean /= summary.records;
+		summary.peakWidthMean /= summary.records;
+		summary.matchMean /= summary.records;
+	}
+	return ok;
+}
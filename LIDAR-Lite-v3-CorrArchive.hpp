@@ -0,0 +1,129 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-CorrArchive.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_CORRARCHIVE_HPP
+#define LIDAR_LITE_V3_CORRARCHIVE_HPP
+
+#include <cstddef>
+#include "LIDAR-Lite-v3-MultiReturn.hpp"
+
+/* Acquisition settings stored with every correlation record */
+struct LIDAR_Lite_v3_CorrSettings
+{
+	uint8_t sigCountVal;     // SIG_COUNT_VAL
+	uint8_t acqConfigReg;    // ACQ_CONFIG_REG
+	uint8_t refCountVal;     // REF_COUNT_VAL
+	uint8_t thresholdBypass; // THRESHOLD_BYPASS
+};
+
+/*
+ * Columnar, memory mapped archive of correlation records.
+ *
+ * File layout: Header, then the columns unitId[capacity] (uint16_t), settings[capacity]
+ * and records[capacity][RECORD_SIZE] (int16_t). Every column starts on a 64 byte boundary.
+ * The file is sized for its capacity when created, count grows as records are appended.
+ */
+class LIDAR_Lite_v3_CorrArchive
+{
+public:
+	static const uint16_t RECORD_SIZE = LIDAR_Lite_v3_MultiReturn::RECORD_SIZE;
+	static const uint32_t VERSION = 1;
+
+	struct Header
+	{
+		char magic[8]; // "LLV3CORR"
+		uint32_t version;
+		uint32_t recordSize;
+		uint64_t capacity;
+		uint64_t count;
+	};
+
+	LIDAR_Lite_v3_CorrArchive();
+	~LIDAR_Lite_v3_CorrArchive();
+
+	/* Create a new archive for up to capacity records, opened for appending */
+	bool create(const char *path, uint64_t capacity);
+	/* Map an existing archive read-only */
+	bool open(const char *path);
+	void close();
+
+	/* Append one record, returns false if the archive is full or read-only */
+	bool append(uint16_t unitId, const LIDAR_Lite_v3_CorrSettings &settings, const int16_t *record);
+	/* Read UNIT_ID and settings, download the correlation record and append it */
+	bool capture(LIDAR_Lite_v3_Base &device);
+
+	uint64_t count() const { return m_header ? m_header->count : 0; }
+	uint64_t capacity() const { return m_header ? m_header->capacity : 0; }
+
+	/* Column access */
+	const uint16_t *unitIds() const { return m_unitIds; }
+	const LIDAR_Lite_v3_CorrSettings *settings() const { return m_settings; }
+	const int16_t *record(uint64_t i) const { return m_records + i * RECORD_SIZE; }
+
+private:
+	LIDAR_Lite_v3_CorrArchive(const LIDAR_Lite_v3_CorrArchive &);
+	LIDAR_Lite_v3_CorrArchive &operator=(const LIDAR_Lite_v3_CorrArchive &);
+
+	static size_t fileSize(uint64_t capacity);
+	bool map(int fd, size_t size, bool writable);
+	void layout();
+
+	void *m_base;
+	size_t m_size;
+	bool m_writable;
+	Header *m_header;
+	uint16_t *m_unitIds;
+	LIDAR_Lite_v3_CorrSettings *m_settings;
+	int16_t *m_records;
+};
+
+/* Per record analysis results */
+struct LIDAR_Lite_v3_CorrResult
+{
+	float noiseFloor; // RMS of the record outside the peak lobe
+	uint16_t peakIndex;
+	uint16_t peakWidth; // contiguous samples around the peak at or above half its value
+	float match;      // normalized correlation with the template, -1..1
+};
+
+/* Archive wide summary */
+struct LIDAR_Lite_v3_CorrSummary
+{
+	uint64_t records;
+	double noiseFloorMean;
+	double noiseFloorMax;
+	double peakWidthMean;
+	uint16_t peakWidthMin;
+	uint16_t peakWidthMax;
+	double matchMean;
+	double matchMin;
+};
+
+/*
+ * Batch analytics over a LIDAR_Lite_v3_CorrArchive. Records are split across threads in contiguous
+ * ranges, the inner loops are plain integer reductions over RECORD_SIZE entries so the compiler
+ * can vectorize them (build with -O3 and the host -march).
+ */
+class LIDAR_Lite_v3_CorrAnalytics
+{
+public:
+	/* Samples on each side of the peak excluded from the noise floor */
+	static const uint16_t PEAK_GUARD = 8;
+
+	/* Analyze one record. Template entries must be within [-255, 255]. */
+	static void analyze(const int16_t *record, const int16_t *tmpl, LIDAR_Lite_v3_CorrResult &out);
+
+	/* Analyze the whole archive with the given number of threads. results may be 0, otherwise it holds count() entries. */
+	static bool run(const LIDAR_Lite_v3_CorrArchive &archive, const int16_t *tmpl, unsigned threads,
+		LIDAR_Lite_v3_CorrSummary &summary, LIDAR_Lite_v3_CorrResult *results=0);
+};
+
+#endif /* LIDAR_LITE_V3_CORRARCHIVE_HPP */
@@ -0,0 +1,264 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-EventLoop.cpp
+ */
+
+#include "LIDAR-Lite-v3-EventLoop.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_EventLoop::LIDAR_Lite_v3_EventLoop(LIDAR_Lite_v3_LoopHandler *handler, uint8_t biasInterval)
+	: m_handler(handler), m_biasInterval(biasInterval), m_count(0), m_epoll(-1), m_timer(-1), m_wake(-1), m_stop(0)
+{
+}
+
+LIDAR_Lite_v3_EventLoop::~LIDAR_Lite_v3_EventLoop()
+{
+	close();
+}
+
+bool LIDAR_Lite_v3_EventLoop::open()
+{
+	close();
+	m_epoll = epoll_create1(EPOLL_CLOEXEC);
+	m_timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	m_wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (m_epoll < 0 || m_timer < 0 || m_wake < 0)
+	{
+		close();
+		return false;
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.fd = m_timer;
+	bool ok = epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_timer, &event) == 0;
+	event.data.fd = m_wake;
+	ok = ok && epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake, &event) == 0;
+	if (!ok)
+	{
+		close();
+		return false;
+	}
+
+	/* Sensors added before open() start now */
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	for (uint8_t i = 0; i < m_count; i++)
+		m_sensors[i].deadline = m_sensors[i].scheduled = now;
+	if (m_count)
+		arm(now);
+	return true;
+}
+
+void LIDAR_Lite_v3_EventLoop::close()
+{
+	if (m_epoll >= 0)
+		::close(m_epoll);
+	if (m_timer >= 0)
+		::close(m_timer);
+	if (m_wake >= 0)
+		::close(m_wake);
+	m_epoll = m_timer = m_wake = -1;
+}
+
+int LIDAR_Lite_v3_EventLoop::add(LIDAR_Lite_v3_Base &device, uint64_t periodNs, uint64_t expectedNs)
+{
+	if (m_count >= MAX_SENSORS)
+		return -1;
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	Sensor &s = m_sensors[m_count];
+	s = Sensor();
+	s.device = &device;
+	s.trigger = LIDAR_Lite_v3_Trigger(m_biasInterval);
+	s.phase = TRIGGER;
+	s.periodNs = periodNs;
+	s.expectedNs = expectedNs ? expectedNs : MIN_POLL_NS;
+	s.deadline = s.scheduled = s.startNs = now;
+	if (m_timer >= 0)
+		arm(now);
+	return m_count++;
+}
+
+void LIDAR_Lite_v3_EventLoop::arm(uint64_t deadline)
+{
+	struct itimerspec spec;
+	memset(&spec, 0, sizeof(spec));
+	/* A zero it_value disarms, the earliest representable deadline is 1 ns */
+	if (deadline == 0)
+		deadline = 1;
+	spec.it_value.tv_sec = deadline / 1000000000ull;
+	spec.it_value.tv_nsec = deadline % 1000000000ull;
+	timerfd_settime(m_timer, TFD_TIMER_ABSTIME, &spec, 0);
+}
+
+void LIDAR_Lite_v3_EventLoop::step(uint8_t index, uint64_t now)
+{
+	Sensor &s = m_sensors[index];
+	if (s.phase == TRIGGER)
+	{
+		s.trigger.fire(*s.device);
+		s.triggered = now;
+		s.phase = WAIT;
+		s.pollsThisCycle = 0;
+		s.deadline = now + s.expectedNs;
+		return;
+	}
+
+	uint8_t status = s.device->getSTATUS();
+	s.polls++;
+	s.pollsThisCycle++;
+	if (status & B::STATUS::BusyFlag::mask)
+	{
+		if (now - s.triggered > TIMEOUT_NS)
+		{
+			s.failures++;
+			s.phase = TRIGGER;
+			s.deadline = now;
+			return;
+		}
+		uint64_t interval = s.expectedNs / 8;
+		if (interval < MIN_POLL_NS)
+			interval = MIN_POLL_NS;
+		s.deadline = now + interval;
+		return;
+	}
+
+	s.latest.status = status;
+	s.latest.signalStrength = s.device->getSIGNAL_STRENGTH();
+	s.latest.distance = s.device->getFULL_DELAY();
+	uint64_t readout = LIDAR_Lite_v3_Clock::now();
+	s.samples++;
+
+	/* Ready at the first poll: the estimate may be late, creep down. Otherwise it was early. */
+	if (s.pollsThisCycle == 1)
+		s.expectedNs -= s.expectedNs / 16;
+	else
+		s.expectedNs = now - s.triggered;
+	if (s.expectedNs < MIN_POLL_NS)
+		s.expectedNs = MIN_POLL_NS;
+
+	if (m_handler)
+		m_handler->measurement(index, s.latest, readout);
+
+	/* Fixed rate sensors skip missed periods rather than bursting to catch up */
+	s.phase = TRIGGER;
+	if (s.periodNs)
+	{
+		s.scheduled += s.periodNs;
+		if (s.scheduled < readout)
+			s.scheduled = readout;
+		s.deadline = s.scheduled;
+	}
+	else
+		s.deadline = s.scheduled = readout;
+}
+
+void LIDAR_Lite_v3_EventLoop::dispatch()
+{
+	uint64_t expirations;
+	while (read(m_timer, &expirations, sizeof(expirations)) > 0)
+		;
+	uint64_t wakeups;
+	while (read(m_wake, &wakeups, sizeof(wakeups)) > 0)
+		;
+
+	for (uint8_t pass = 0; ; pass++)
+	{
+		uint64_t now = LIDAR_Lite_v3_Clock::now();
+		uint64_t next = ~(uint64_t)0;
+		for (uint8_t i = 0; i < m_count; i++)
+		{
+			if (m_sensors[i].deadline <= now)
+			{
+				step(i, now);
+				now = LIDAR_Lite_v3_Clock::now();
+			}
+			if (m_sensors[i].deadline < next)
+				next = m_sensors[i].deadline;
+		}
+		if (m_count == 0)
+			return;
+		/*
+		 * Steps that came due while the bus was busy run now instead of after another wake-up, for a
+		 * few passes: on a saturated bus there is always a step due and dispatch() must still return.
+		 */
+		if (next > LIDAR_Lite_v3_Clock::now() || pass + 1 >= MAX_PASSES)
+		{
+			arm(next);
+			return;
+		}
+	}
+}
+
+void LIDAR_Lite_v3_EventLoop::run()
+{
+	/* Without an epoll descriptor epoll_wait() fails at once and the loop would spin */
+	if (m_epoll < 0)
+		return;
+	__atomic_store_n(&m_stop, 0, __ATOMIC_RELAXED);
+	dispatch();
+	while (!__atomic_load_n(&m_stop, __ATOMIC_RELAXED))
+	{
+		struct epoll_event events[2];
+		if (epoll_wait(m_epoll, events, 2, -1) > 0)
+			dispatch();
+	}
+}
+
+void LIDAR_Lite_v3_EventLoop::stop()
+{
+	__atomic_store_n(&m_stop, 1, __ATOMIC_RELAXED);
+	if (m_wake < 0)
+		return;
+	uint64_t one = 1;
+	ssize_t n = write(m_wake, &one, sizeof(one));
+	(void)n;
+}
+
+bool LIDAR_Lite_v3_EventLoop::latest(uint8_t sensor, LIDAR_Lite_v3_Measurement &measurement) const
+{
+	if (sensor >= m_count)
+		return false;
+	measurement = m_sensors[sensor].latest;
+	return true;
+}
+
+bool LIDAR_Lite_v3_EventLoop::report(uint8_t sensor, Report &r) const
+{
+	if (sensor >= m_count)
+		return false;
+	const Sensor &s = m_sensors[sensor];
+	r.samples = s.samples;
+	r.failures = s.failures;
+	r.polls = s.polls;
+	r.expectedNs = s.expectedNs;
+	r.elapsedNs = LIDAR_Lite_v3_Clock::now() - s.startNs;
+	r.hz = r.elapsedNs ? s.samples * 1e9 / r.elapsedNs : 0.0;
+	return true;
+}
+
+void LIDAR_Lite_v3_EventLoop::clearReport()
+{
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	for (uint8_t i = 0; i < m_count; i++)
+	{
+		m_sensors[i].samples = 0;
+		m_sensors[i].failures = 0;
+		m_sensors[i].polls = 0;
+		m_sensors[i].startNs = now;
+	}
+}
@@ -0,0 +1,123 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-EventLoop.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_EVENTLOOP_HPP
+#define LIDAR_LITE_V3_EVENTLOOP_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+
+/* Receives the measurements of an event loop, called on the loop's thread */
+class LIDAR_Lite_v3_LoopHandler
+{
+public:
+	virtual ~LIDAR_Lite_v3_LoopHandler() {}
+	virtual void measurement(uint8_t sensor, const LIDAR_Lite_v3_Measurement &measurement, uint64_t readout) = 0;
+};
+
+/*
+ * Drives the trigger, wait, read cycle of many sensors from one thread with epoll and a timerfd.
+ *
+ * Each sensor has a deadline for its next step. After a trigger the first STATUS poll is scheduled
+ * at the expected acquisition time, learned per sensor: it shrinks while the device is ready at the
+ * first poll and jumps to the observed time when it is not. Other sensors are serviced while one
+ * acquires, the thread only sleeps in epoll_wait. fd() is an epoll descriptor that becomes readable
+ * when a deadline passes, so the loop can be nested in an application's own poll/epoll loop by
+ * calling dispatch() when it is readable, or run() can own the thread.
+ *
+ * The register accesses themselves are synchronous, so sensors on separate buses are serialized.
+ */
+class LIDAR_Lite_v3_EventLoop
+{
+public:
+	static const uint8_t MAX_SENSORS = 64;
+	/* Initial expected acquisition time, about right for the default SIG_COUNT_VAL */
+	static const uint64_t DEFAULT_EXPECTED_NS = 10000000ull;
+	/* Shortest STATUS re-poll interval while busy */
+	static const uint64_t MIN_POLL_NS = 100000ull;
+	/* A measurement still busy after this long is abandoned and retriggered */
+	static const uint64_t TIMEOUT_NS = 200000000ull;
+	/* Passes over the sensors per dispatch() before returning to epoll */
+	static const uint8_t MAX_PASSES = 4;
+
+	struct Report
+	{
+		uint64_t samples;
+		uint64_t failures;   // busy timeouts
+		uint64_t polls;      // STATUS reads
+		uint64_t expectedNs; // current acquisition time estimate
+		uint64_t elapsedNs;
+		double hz;
+	};
+
+	LIDAR_Lite_v3_EventLoop(LIDAR_Lite_v3_LoopHandler *handler=0, uint8_t biasInterval=100);
+	~LIDAR_Lite_v3_EventLoop();
+
+	/* Create the epoll, timer and wake-up descriptors */
+	bool open();
+	void close();
+	int fd() const { return m_epoll; }
+
+	/* Add a sensor triggered every periodNs (0: back to back), returns its index or -1 */
+	int add(LIDAR_Lite_v3_Base &device, uint64_t periodNs=0, uint64_t expectedNs=DEFAULT_EXPECTED_NS);
+
+	/* Run the steps that are due and rearm the timer, call when fd() is readable */
+	void dispatch();
+	/* Dispatch until stop(), which may be called from any thread. Returns at once if the epoll descriptor could not be created. */
+	void run();
+	void stop();
+
+	/* Latest measurement and statistics of a sensor, false if there is no such sensor */
+	bool latest(uint8_t sensor, LIDAR_Lite_v3_Measurement &measurement) const;
+	bool report(uint8_t sensor, Report &report) const;
+	void clearReport();
+
+	uint8_t count() const { return m_count; }
+
+private:
+	LIDAR_Lite_v3_EventLoop(const LIDAR_Lite_v3_EventLoop &);
+	LIDAR_Lite_v3_EventLoop &operator=(const LIDAR_Lite_v3_EventLoop &);
+
+	enum Phase { TRIGGER, WAIT };
+
+	struct Sensor
+	{
+		LIDAR_Lite_v3_Base *device;
+		uint8_t phase;
+		uint16_t pollsThisCycle;
+		LIDAR_Lite_v3_Trigger trigger;
+		uint64_t periodNs;
+		uint64_t expectedNs;
+		uint64_t deadline;  // next step
+		uint64_t scheduled; // planned time of the current trigger
+		uint64_t triggered; // actual time of the current trigger
+		LIDAR_Lite_v3_Measurement latest;
+		uint64_t samples;
+		uint64_t failures;
+		uint64_t polls;
+		uint64_t startNs;
+	};
+
+	void step(uint8_t index, uint64_t now);
+	void arm(uint64_t deadline);
+
+	LIDAR_Lite_v3_LoopHandler *m_handler;
+	uint8_t m_biasInterval;
+	Sensor m_sensors[MAX_SENSORS];
+	uint8_t m_count;
+	int m_epoll;
+	int m_timer;
+	int m_wake;
+	int m_stop;
+};
+
+#endif /* LIDAR_LITE_V3_EVENTLOOP_HPP */
@@ -0,0 +1,128 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Events.cpp
+ */
+
+#include "LIDAR-Lite-v3-Events.hpp"
+
+#include <cstring>
+
+typedef LIDAR_Lite_v3_Base B;
+
+static const uint8_t STATUS_FLAGS = (uint8_t)~B::STATUS::BusyFlag::mask;
+
+LIDAR_Lite_v3_EventFilter::LIDAR_Lite_v3_EventFilter(uint16_t deadband, uint16_t hysteresis, uint64_t keepAliveNs)
+	: m_deadband(deadband), m_release(hysteresis < deadband ? deadband - hysteresis : 0), m_keepAliveNs(keepAliveNs),
+	  m_samples(0), m_events(0)
+{
+	reset();
+}
+
+void LIDAR_Lite_v3_EventFilter::reset()
+{
+	m_published = false;
+	m_moving = false;
+	m_distance = 0;
+	m_status = 0;
+	m_lastNs = 0;
+}
+
+uint8_t LIDAR_Lite_v3_EventFilter::decide(uint8_t status, uint16_t distance, uint64_t now) const
+{
+	if (!m_published)
+		return FIRST;
+
+	uint8_t reasons = 0;
+	if ((status & STATUS_FLAGS) != m_status)
+		reasons |= STATUS;
+	if (!((status | m_status) & B::STATUS::InvalidSignalFlag::mask))
+	{
+		uint16_t change = distance > m_distance ? distance - m_distance : m_distance - distance;
+		if (m_moving)
+			reasons |= change > m_release ? MOTION : SETTLED;
+		else if (change > m_deadband)
+			reasons |= MOTION;
+	}
+	if (m_keepAliveNs && now - m_lastNs >= m_keepAliveNs)
+		reasons |= KEEPALIVE;
+	return reasons;
+}
+
+uint8_t LIDAR_Lite_v3_EventFilter::update(const LIDAR_Lite_v3_Measurement &measurement, uint64_t now)
+{
+	m_samples++;
+	uint8_t reasons = decide(measurement.status, measurement.distance, now);
+	if (!reasons)
+		return 0;
+
+	m_events++;
+	m_published = true;
+	m_status = measurement.status & STATUS_FLAGS;
+	m_lastNs = now;
+	m_distance = measurement.distance;
+	m_moving = (reasons & MOTION) != 0;
+	return reasons;
+}
+
+LIDAR_Lite_v3_EventSource::LIDAR_Lite_v3_EventSource(LIDAR_Lite_v3_Base &device, LIDAR_Lite_v3_EventFilter &filter, uint8_t biasInterval)
+	: m_device(device), m_filter(filter), m_trigger(biasInterval), m_tracking(false), m_distance(0)
+{
+	clearReport();
+}
+
+void LIDAR_Lite_v3_EventSource::clearReport()
+{
+	memset(&m_report, 0, sizeof(m_report));
+}
+
+uint8_t LIDAR_Lite_v3_EventSource::measure(LIDAR_Lite_v3_Measurement &out, uint64_t now)
+{
+	m_report.measurements++;
+	m_trigger.fire(m_device);
+	uint8_t status;
+	if (!LIDAR_Lite_v3_Trigger::wait(m_device, status))
+	{
+		/* VELOCITY of the next measurement would be relative to this unfinished one */
+		m_tracking = false;
+		m_report.failures++;
+		return 0;
+	}
+
+	bool invalid = (status & B::STATUS::InvalidSignalFlag::mask) != 0;
+	if (m_tracking && !invalid)
+	{
+		int8_t velocity = (int8_t)m_device.getVELOCITY();
+		if (velocity != 127 && velocity != -128)
+		{
+			m_distance = (uint16_t)(m_distance + velocity);
+			if (!m_filter.decide(status, m_distance, now))
+			{
+				LIDAR_Lite_v3_Measurement estimate;
+				estimate.distance = m_distance;
+				estimate.status = status;
+				estimate.signalStrength = 0;
+				m_filter.update(estimate, now);
+				m_report.velocityReads++;
+				return 0;
+			}
+		}
+	}
+
+	out.status = status;
+	out.signalStrength = m_device.getSIGNAL_STRENGTH();
+	out.distance = m_device.getFULL_DELAY();
+	m_distance = out.distance;
+	m_tracking = !invalid;
+	m_report.fullReads++;
+
+	uint8_t reasons = m_filter.update(out, now);
+	if (reasons)
+		m_report.events++;
+	return reasons;
+}
@@ -0,0 +1,107 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Events.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_EVENTS_HPP
+#define LIDAR_LITE_V3_EVENTS_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+/*
+ * Change driven sample filter.
+ *
+ * A sample is published when the distance leaves the deadband around the last published distance.
+ * The target is then tracked: every sample that moves more than deadband - hysteresis is published,
+ * and the first one that does not ends the motion and is published as the settled value. Changes
+ * of the STATUS flags (BusyFlag ignored) and the keep-alive interval also publish a sample.
+ * Distances of samples with InvalidSignalFlag set are not compared.
+ */
+class LIDAR_Lite_v3_EventFilter
+{
+public:
+	/* Reasons for publishing, combined in the value returned by update() */
+	static const uint8_t FIRST = 1;
+	static const uint8_t MOTION = 2;
+	static const uint8_t SETTLED = 4;
+	static const uint8_t STATUS = 8;
+	static const uint8_t KEEPALIVE = 16;
+
+	/* Deadband and hysteresis in centimeters, hysteresis below deadband. keepAliveNs 0 disables keep-alives. */
+	LIDAR_Lite_v3_EventFilter(uint16_t deadband, uint16_t hysteresis=0, uint64_t keepAliveNs=1000000000ull);
+
+	/* Reasons a sample with this status and distance would be published, 0 if it would be suppressed */
+	uint8_t decide(uint8_t status, uint16_t distance, uint64_t now) const;
+	/* decide() and update the state, returns the reasons */
+	uint8_t update(const LIDAR_Lite_v3_Measurement &measurement, uint64_t now=LIDAR_Lite_v3_Clock::now());
+
+	/* Forget the published state, the next sample is published */
+	void reset();
+
+	uint64_t samples() const { return m_samples; }
+	uint64_t events() const { return m_events; }
+
+private:
+	uint16_t m_deadband;
+	uint16_t m_release; // motion ends at or below this change
+	uint64_t m_keepAliveNs;
+	bool m_published;
+	bool m_moving;
+	uint16_t m_distance; // last published distance
+	uint8_t m_status;    // last published STATUS flags
+	uint64_t m_lastNs;   // time of the last publication
+	uint64_t m_samples;
+	uint64_t m_events;
+};
+
+/*
+ * Acquisition path for the event mode. After each measurement the 1 byte VELOCITY register (the
+ * signed change since the previous measurement) is read instead of FULL_DELAY and SIGNAL_STRENGTH;
+ * the running sum tracks the device distance exactly. Only samples the filter would publish are read
+ * in full, which also resynchronizes the tracked distance. Saturated velocities and invalid signals
+ * force a full read.
+ */
+class LIDAR_Lite_v3_EventSource
+{
+public:
+	static const uint16_t BUSY_POLL_LIMIT = LIDAR_Lite_v3_Trigger::BUSY_POLL_LIMIT;
+
+	struct Report
+	{
+		uint64_t measurements;
+		uint64_t fullReads;
+		uint64_t velocityReads; // samples settled with the VELOCITY register alone
+		uint64_t events;
+		uint64_t failures;      // device stayed busy
+	};
+
+	LIDAR_Lite_v3_EventSource(LIDAR_Lite_v3_Base &device, LIDAR_Lite_v3_EventFilter &filter, uint8_t biasInterval=100);
+
+	/*
+	 * Take one measurement. Returns the publication reasons with the sample in out, or 0 if the sample
+	 * was suppressed or the device stayed busy.
+	 */
+	uint8_t measure(LIDAR_Lite_v3_Measurement &out, uint64_t now=LIDAR_Lite_v3_Clock::now());
+
+	Report report() const { return m_report; }
+	void clearReport();
+
+private:
+	LIDAR_Lite_v3_Base &m_device;
+	LIDAR_Lite_v3_EventFilter &m_filter;
+	LIDAR_Lite_v3_Trigger m_trigger;
+	bool m_tracking;     // m_distance follows the device
+	uint16_t m_distance;
+	Report m_report;
+};
+
+#endif /* LIDAR_LITE_V3_EVENTS_HPP */
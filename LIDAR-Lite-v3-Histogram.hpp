@@ -0,0 +1,130 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Histogram.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_HISTOGRAM_HPP
+#define LIDAR_LITE_V3_HISTOGRAM_HPP
+
+#include <cinttypes>
+#include <cmath>
+
+/*
+ * Fixed memory latency histogram. Values (nanoseconds) go into log2 buckets split into
+ * SUB_BUCKETS linear steps, which bounds the percentile error to 1/SUB_BUCKETS of the value.
+ * Mean and variance are kept exactly (Welford).
+ */
+class LIDAR_Lite_v3_Histogram
+{
+public:
+	static const unsigned SUB_BITS = 3;
+	static const unsigned SUB_BUCKETS = 1 << SUB_BITS;
+	static const unsigned BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS;
+
+	LIDAR_Lite_v3_Histogram() { clear(); }
+
+	void clear()
+	{
+		for (unsigned i = 0; i < BUCKETS; i++)
+			m_buckets[i] = 0;
+		m_count = 0;
+		m_min = ~(uint64_t)0;
+		m_max = 0;
+		m_mean = 0;
+		m_m2 = 0;
+	}
+
+	void add(uint64_t value)
+	{
+		m_buckets[bucket(value)]++;
+		m_count++;
+		if (value < m_min)
+			m_min = value;
+		if (value > m_max)
+			m_max = value;
+		double delta = (double)value - m_mean;
+		m_mean += delta / m_count;
+		m_m2 += delta * ((double)value - m_mean);
+	}
+
+	uint64_t count() const { return m_count; }
+	uint64_t min() const { return m_count ? m_min : 0; }
+	uint64_t max() const { return m_max; }
+	double mean() const { return m_mean; }
+	double stddev() const { return m_count > 1 ? std::sqrt(m_m2 / (m_count - 1)) : 0.0; }
+
+	/* Upper bound of the bucket holding quantile q (0..1) */
+	uint64_t percentile(double q) const
+	{
+		if (m_count == 0)
+			return 0;
+		uint64_t rank = (uint64_t)std::ceil(q * m_count);
+		if (rank == 0)
+			rank = 1;
+		uint64_t seen = 0;
+		for (unsigned i = 0; i < BUCKETS; i++)
+		{
+			seen += m_buckets[i];
+			if (seen >= rank)
+			{
+				uint64_t upper = upperBound(i);
+				return upper < m_max ? upper : m_max;
+			}
+		}
+		return m_max;
+	}
+
+	/* Add all samples of another histogram */
+	void merge(const LIDAR_Lite_v3_Histogram &other)
+	{
+		if (other.m_count == 0)
+			return;
+		for (unsigned i = 0; i < BUCKETS; i++)
+			m_buckets[i] += other.m_buckets[i];
+		double delta = other.m_mean - m_mean;
+		uint64_t count = m_count + other.m_count;
+		m_m2 += other.m_m2 + delta * delta * ((double)m_count * other.m_count / count);
+		m_mean += delta * other.m_count / count;
+		m_count = count;
+		if (other.m_min < m_min)
+			m_min = other.m_min;
+		if (other.m_max > m_max)
+			m_max = other.m_max;
+	}
+
+private:
+	static unsigned bucket(uint64_t value)
+	{
+		if (value < SUB_BUCKETS)
+			return (unsigned)value;
+		unsigned msb = 63;
+		while (!(value >> msb))
+			msb--;
+		unsigned shift = msb - SUB_BITS;
+		return (shift + 1) * SUB_BUCKETS + (unsigned)((value >> shift) & (SUB_BUCKETS - 1));
+	}
+
+	static uint64_t upperBound(unsigned i)
+	{
+		if (i < SUB_BUCKETS)
+			return i;
+		unsigned shift = i / SUB_BUCKETS - 1;
+		uint64_t base = (uint64_t)(SUB_BUCKETS + i % SUB_BUCKETS) << shift;
+		return base + ((uint64_t)1 << shift) - 1;
+	}
+
+	uint64_t m_buckets[BUCKETS];
+	uint64_t m_count;
+	uint64_t m_min;
+	uint64_t m_max;
+	double m_mean;
+	double m_m2;
+};
+
+#endif /* LIDAR_LITE_V3_HISTOGRAM_HPP */
@@ -0,0 +1,254 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-LoadGenerator.cpp
+ */
+
+#include "LIDAR-Lite-v3-LoadGenerator.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+#include "LIDAR-Lite-v3-EventLoop.hpp"
+#include "LIDAR-Lite-v3-Scheduler.hpp"
+#include "LIDAR-Lite-v3-Publisher.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t resident()
+{
+	/* Second field of /proc/self/statm: resident pages */
+	int fd = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return 0;
+	char text[128];
+	ssize_t n = read(fd, text, sizeof(text) - 1);
+	close(fd);
+	if (n <= 0)
+		return 0;
+	text[n] = 0;
+	const char *p = text;
+	while (*p && *p != ' ')
+		p++;
+	uint64_t pages = 0;
+	for (p++; *p >= '0' && *p <= '9'; p++)
+		pages = pages * 10 + (*p - '0');
+	return pages * (uint64_t)sysconf(_SC_PAGESIZE);
+}
+
+static double cpuSeconds()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0.0;
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+
+LIDAR_Lite_v3_LoadGenerator::LIDAR_Lite_v3_LoadGenerator(const LIDAR_Lite_v3_SimTiming &timing, const LIDAR_Lite_v3_SimFaults &faults,
+	const LIDAR_Lite_v3_SimScript &script)
+	: m_timing(timing), m_faults(faults), m_script(script), m_busSize(0)
+{
+}
+
+const char *LIDAR_Lite_v3_LoadGenerator::name(Path path)
+{
+	switch (path)
+	{
+	case EVENT_LOOP: return "eventloop";
+	case SCHEDULER: return "scheduler";
+	case PUBLISHER: return "publisher";
+	}
+	return "";
+}
+
+bool LIDAR_Lite_v3_LoadGenerator::run(Path path, uint16_t sensors, uint64_t durationNs, Result &result)
+{
+	memset(&result, 0, sizeof(result));
+	if (sensors == 0 || sensors > MAX_SENSORS)
+		return false;
+
+	/* Instrumentation is allocated and touched before the baseline so it does not count per sensor */
+	LIDAR_Lite_v3_Histogram *latency = new LIDAR_Lite_v3_Histogram[sensors];
+	LIDAR_Lite_v3_SimulatedDevice **devices = new LIDAR_Lite_v3_SimulatedDevice *[sensors];
+	uint16_t perBus = m_busSize ? m_busSize : sensors;
+	uint16_t busCount = (sensors + perBus - 1) / perBus;
+	LIDAR_Lite_v3_SimBus *buses = new LIDAR_Lite_v3_SimBus[busCount];
+	uint64_t rssBefore = resident();
+	double cpuBefore = cpuSeconds();
+
+	for (uint16_t i = 0; i < sensors; i++)
+	{
+		devices[i] = new LIDAR_Lite_v3_SimulatedDevice(m_timing, m_faults, m_script, i + 1, &buses[i / perBus]);
+		devices[i]->latency(&latency[i]);
+	}
+
+	uint64_t start = LIDAR_Lite_v3_Clock::now();
+	bool ok = false;
+	uint32_t pathBytes = 0;
+	switch (path)
+	{
+	case EVENT_LOOP:
+		ok = eventLoop(devices, sensors, durationNs);
+		pathBytes = sizeof(LIDAR_Lite_v3_EventLoop) / LIDAR_Lite_v3_EventLoop::MAX_SENSORS;
+		break;
+	case SCHEDULER:
+		ok = scheduler(devices, sensors, durationNs);
+		pathBytes = sizeof(LIDAR_Lite_v3_Scheduler) / LIDAR_Lite_v3_Scheduler::MAX_SENSORS + sizeof(LIDAR_Lite_v3_Measurement);
+		break;
+	case PUBLISHER:
+		ok = publisher(devices, sensors, durationNs);
+		pathBytes = sizeof(LIDAR_Lite_v3_Publisher);
+		break;
+	}
+	uint64_t elapsed = LIDAR_Lite_v3_Clock::now() - start;
+	uint64_t rssAfter = resident();
+
+	LIDAR_Lite_v3_Histogram merged;
+	result.sensors = sensors;
+	result.buses = busCount;
+	uint64_t busiest = 0;
+	for (uint16_t b = 0; b < busCount; b++)
+		busiest = buses[b].busyNs() > busiest ? buses[b].busyNs() : busiest;
+	result.busLoad = elapsed ? (double)busiest / elapsed : 0.0;
+	result.seconds = elapsed * 1e-9;
+	for (uint16_t i = 0; i < sensors; i++)
+	{
+		LIDAR_Lite_v3_SimulatedDevice::Stats s = devices[i]->stats();
+		result.commands += s.commands;
+		result.results += s.results;
+		result.delivered += s.delivered;
+		result.nacks += s.nacks;
+		result.sleeps += s.sleeps;
+		result.healthFaults += s.healthFaults;
+		merged.merge(latency[i]);
+		delete devices[i];
+	}
+	delete[] devices;
+	delete[] buses;
+	delete[] latency;
+
+	result.hz = elapsed ? result.delivered * 1e9 / elapsed : 0.0;
+	result.hzPerSensor = result.hz / sensors;
+	result.latencyP50Ns = merged.percentile(0.5);
+	result.latencyP99Ns = merged.percentile(0.99);
+	result.latencyP999Ns = merged.percentile(0.999);
+	result.latencyMaxNs = merged.max();
+	result.cpuSeconds = cpuSeconds() - cpuBefore;
+	result.stateBytes = sizeof(LIDAR_Lite_v3_SimulatedDevice) + pathBytes;
+	result.residentBytes = rssAfter > rssBefore ? (rssAfter - rssBefore) / sensors : 0;
+	return ok;
+}
+
+uint8_t LIDAR_Lite_v3_LoadGenerator::sweep(Path path, const uint16_t *sizes, uint8_t count, uint64_t durationNs, Result *results)
+{
+	uint8_t done = 0;
+	while (done < count && run(path, sizes[done], durationNs, results[done]))
+		done++;
+	return done;
+}
+
+bool LIDAR_Lite_v3_LoadGenerator::eventLoop(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs)
+{
+	const uint16_t per = LIDAR_Lite_v3_EventLoop::MAX_SENSORS;
+	uint16_t loopCount = (count + per - 1) / per;
+	LIDAR_Lite_v3_EventLoop **loops = new LIDAR_Lite_v3_EventLoop *[loopCount];
+	for (uint16_t l = 0; l < loopCount; l++)
+		loops[l] = 0;
+
+	int outer = epoll_create1(EPOLL_CLOEXEC);
+	bool ok = outer >= 0;
+	for (uint16_t l = 0; ok && l < loopCount; l++)
+	{
+		loops[l] = new LIDAR_Lite_v3_EventLoop();
+		for (uint16_t i = l * per; i < count && i < (l + 1) * per; i++)
+			loops[l]->add(*devices[i]);
+		struct epoll_event event;
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.ptr = loops[l];
+		ok = loops[l]->open() && epoll_ctl(outer, EPOLL_CTL_ADD, loops[l]->fd(), &event) == 0;
+	}
+
+	if (ok)
+	{
+		for (uint16_t l = 0; l < loopCount; l++)
+			loops[l]->dispatch();
+		uint64_t end = LIDAR_Lite_v3_Clock::now() + durationNs;
+		for (uint64_t now = LIDAR_Lite_v3_Clock::now(); now < end; now = LIDAR_Lite_v3_Clock::now())
+		{
+			struct epoll_event events[16];
+			int timeout = (int)((end - now) / 1000000) + 1;
+			int n = epoll_wait(outer, events, 16, timeout);
+			for (int i = 0; i < n; i++)
+				((LIDAR_Lite_v3_EventLoop *)events[i].data.ptr)->dispatch();
+		}
+	}
+
+	for (uint16_t l = 0; l < loopCount; l++)
+		delete loops[l];
+	delete[] loops;
+	if (outer >= 0)
+		close(outer);
+	return ok;
+}
+
+bool LIDAR_Lite_v3_LoadGenerator::scheduler(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs)
+{
+	const uint16_t per = LIDAR_Lite_v3_Scheduler::MAX_SENSORS;
+	uint16_t groupCount = (count + per - 1) / per;
+	LIDAR_Lite_v3_Base **sensors = new LIDAR_Lite_v3_Base *[count];
+	for (uint16_t i = 0; i < count; i++)
+		sensors[i] = devices[i];
+	LIDAR_Lite_v3_Scheduler **groups = new LIDAR_Lite_v3_Scheduler *[groupCount];
+	for (uint16_t g = 0; g < groupCount; g++)
+	{
+		uint16_t first = g * per;
+		uint16_t n = count - first < per ? count - first : per;
+		groups[g] = new LIDAR_Lite_v3_Scheduler(sensors + first, (uint8_t)n);
+	}
+
+	/* Groups take turns, every cycle() triggers and reads out all sensors of one group */
+	LIDAR_Lite_v3_Measurement out[LIDAR_Lite_v3_Scheduler::MAX_SENSORS];
+	uint64_t end = LIDAR_Lite_v3_Clock::now() + durationNs;
+	for (uint16_t g = 0; LIDAR_Lite_v3_Clock::now() < end; g = (g + 1) % groupCount)
+		groups[g]->cycle(out);
+
+	for (uint16_t g = 0; g < groupCount; g++)
+		delete groups[g];
+	delete[] groups;
+	delete[] sensors;
+	return true;
+}
+
+bool LIDAR_Lite_v3_LoadGenerator::publisher(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs)
+{
+	LIDAR_Lite_v3_Publisher **publishers = new LIDAR_Lite_v3_Publisher *[count];
+	bool ok = true;
+	for (uint16_t i = 0; i < count; i++)
+	{
+		publishers[i] = new LIDAR_Lite_v3_Publisher(*devices[i]);
+		ok = publishers[i]->start() && ok;
+	}
+
+	if (ok)
+	{
+		struct timespec ts;
+		ts.tv_sec = durationNs / 1000000000ull;
+		ts.tv_nsec = durationNs % 1000000000ull;
+		while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+			;
+	}
+
+	for (uint16_t i = 0; i < count; i++)
+		delete publishers[i];
+	delete[] publishers;
+	return ok;
+}
@@ -0,0 +1,87 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-LoadGenerator.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_LOADGENERATOR_HPP
+#define LIDAR_LITE_V3_LOADGENERATOR_HPP
+
+#include "LIDAR-Lite-v3-Simulator.hpp"
+
+/*
+ * Drives a fleet of simulated devices through one of the library's acquisition paths for a fixed
+ * time and reports what the host achieved:
+ *
+ *   EVENT_LOOP  one thread, event loops of up to 64 sensors nested in an outer epoll
+ *   SCHEDULER   one thread, schedulers of up to 32 sensors cycled in turn
+ *   PUBLISHER   one publisher thread per sensor
+ *
+ * The fleet shares simulated buses (busSize()), so transfers of devices on one bus serialize
+ * whichever path drives them. Latency is measured on the devices: from a result completing to its
+ * FULL_DELAY being read. Run the same path over growing fleets with sweep() to find where it stops
+ * scaling.
+ */
+class LIDAR_Lite_v3_LoadGenerator
+{
+public:
+	enum Path { EVENT_LOOP, SCHEDULER, PUBLISHER };
+
+	static const uint16_t MAX_SENSORS = 4096;
+
+	struct Result
+	{
+		uint16_t sensors;
+		uint16_t buses;
+		double seconds;
+		uint64_t commands;
+		uint64_t results;       // acquisitions the devices completed
+		uint64_t delivered;     // of those, read by the host
+		uint64_t nacks;
+		uint64_t sleeps;
+		uint64_t healthFaults;
+		double hz;              // delivered per second, whole fleet
+		double hzPerSensor;
+		uint64_t latencyP50Ns;
+		uint64_t latencyP99Ns;
+		uint64_t latencyP999Ns;
+		uint64_t latencyMaxNs;
+		double busLoad;         // busiest bus: transfer time over run time
+		double cpuSeconds;      // process user and system time
+		uint32_t stateBytes;    // per sensor: device model plus the path's own state
+		uint64_t residentBytes; // per sensor: resident set growth over the run, 0 if memory was reused
+	};
+
+	LIDAR_Lite_v3_LoadGenerator(const LIDAR_Lite_v3_SimTiming &timing, const LIDAR_Lite_v3_SimFaults &faults,
+		const LIDAR_Lite_v3_SimScript &script);
+
+	/* Devices per simulated bus, 0 (the default) puts the whole fleet on one bus */
+	void busSize(uint16_t sensors) { m_busSize = sensors; }
+
+	/* Run a fleet of sensors for durationNs, false if it could not be set up */
+	bool run(Path path, uint16_t sensors, uint64_t durationNs, Result &result);
+	/* Run each fleet size in turn, returns the number of results filled */
+	uint8_t sweep(Path path, const uint16_t *sizes, uint8_t count, uint64_t durationNs, Result *results);
+
+	static const char *name(Path path);
+
+private:
+	LIDAR_Lite_v3_LoadGenerator(const LIDAR_Lite_v3_LoadGenerator &);
+	LIDAR_Lite_v3_LoadGenerator &operator=(const LIDAR_Lite_v3_LoadGenerator &);
+
+	bool eventLoop(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs);
+	bool scheduler(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs);
+	bool publisher(LIDAR_Lite_v3_SimulatedDevice **devices, uint16_t count, uint64_t durationNs);
+
+	LIDAR_Lite_v3_SimTiming m_timing;
+	LIDAR_Lite_v3_SimFaults m_faults;
+	LIDAR_Lite_v3_SimScript m_script;
+	uint16_t m_busSize;
+};
+
+#endif /* LIDAR_LITE_V3_LOADGENERATOR_HPP */
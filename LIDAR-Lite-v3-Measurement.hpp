@@ -0,0 +1,25 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Measurement.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_MEASUREMENT_HPP
+#define LIDAR_LITE_V3_MEASUREMENT_HPP
+
+#include <cinttypes>
+
+/* One distance sample as read from the device */
+struct LIDAR_Lite_v3_Measurement
+{
+	uint16_t distance;      // FULL_DELAY, centimeters
+	uint8_t status;         // STATUS at measurement completion
+	uint8_t signalStrength; // SIGNAL_STRENGTH
+};
+
+#endif /* LIDAR_LITE_V3_MEASUREMENT_HPP */
@@ -0,0 +1,407 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Metrics.cpp
+ */
+
+#include "LIDAR-Lite-v3-Metrics.hpp"
+
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+typedef LIDAR_Lite_v3_Base B;
+
+static const uint64_t NO_EPOCH = ~(uint64_t)0;
+
+LIDAR_Lite_v3_Metrics::LIDAR_Lite_v3_Metrics(uint64_t epochNs, uint64_t now)
+	: m_epochNs(epochNs ? epochNs : 1), m_startNs(now), m_current(0)
+{
+	memset(&m_totals, 0, sizeof(m_totals));
+	for (uint8_t i = 0; i < EPOCHS; i++)
+	{
+		Epoch &epoch = m_epochs[i];
+		epoch.id = i == 0 ? 0 : NO_EPOCH;
+		epoch.samples = epoch.invalid = epoch.biased = epoch.failures = 0;
+	}
+}
+
+LIDAR_Lite_v3_Metrics::Epoch &LIDAR_Lite_v3_Metrics::advance(uint64_t now)
+{
+	uint64_t id = now > m_startNs ? (now - m_startNs) / m_epochNs : 0;
+	if (id > m_current)
+	{
+		/* Only the last EPOCHS epochs can still be in a window */
+		uint64_t first = id - m_current > EPOCHS ? id - EPOCHS + 1 : m_current + 1;
+		for (uint64_t e = first; e <= id; e++)
+		{
+			Epoch &epoch = m_epochs[e % EPOCHS];
+			/* Invalidate before clearing, readers drop an epoch whose id changed under them */
+			__atomic_store_n(&epoch.id, NO_EPOCH, __ATOMIC_RELAXED);
+			__atomic_thread_fence(__ATOMIC_RELEASE);
+			__atomic_store_n(&epoch.samples, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&epoch.invalid, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&epoch.biased, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&epoch.failures, 0, __ATOMIC_RELAXED);
+			epoch.distance.clear();
+			epoch.signal.clear();
+			epoch.noise.clear();
+			__atomic_store_n(&epoch.id, e, __ATOMIC_RELEASE);
+		}
+		m_current = id;
+	}
+	return m_epochs[m_current % EPOCHS];
+}
+
+void LIDAR_Lite_v3_Metrics::add(const LIDAR_Lite_v3_Measurement &measurement, uint8_t noisePeak, bool biased, uint64_t now)
+{
+	Epoch &epoch = advance(now);
+	bool invalid = (measurement.status & B::STATUS::InvalidSignalFlag::mask) != 0;
+
+	increment(epoch.samples);
+	increment(m_totals.samples);
+	if (invalid)
+	{
+		increment(epoch.invalid);
+		increment(m_totals.invalid);
+	}
+	if (biased)
+	{
+		increment(epoch.biased);
+		increment(m_totals.biased);
+	}
+	/* An invalid signal has no meaningful distance */
+	if (!invalid)
+	{
+		epoch.distance.add(measurement.distance);
+		increment(m_totals.distanceSum, measurement.distance);
+	}
+	epoch.signal.add(measurement.signalStrength);
+	increment(m_totals.signalSum, measurement.signalStrength);
+	epoch.noise.add(noisePeak);
+	increment(m_totals.noiseSum, noisePeak);
+}
+
+void LIDAR_Lite_v3_Metrics::addFailure(uint64_t now)
+{
+	increment(advance(now).failures);
+	increment(m_totals.failures);
+}
+
+void LIDAR_Lite_v3_Metrics::totals(Totals &totals) const
+{
+	totals.samples = __atomic_load_n(&m_totals.samples, __ATOMIC_RELAXED);
+	totals.invalid = __atomic_load_n(&m_totals.invalid, __ATOMIC_RELAXED);
+	totals.biased = __atomic_load_n(&m_totals.biased, __ATOMIC_RELAXED);
+	totals.failures = __atomic_load_n(&m_totals.failures, __ATOMIC_RELAXED);
+	totals.distanceSum = __atomic_load_n(&m_totals.distanceSum, __ATOMIC_RELAXED);
+	totals.signalSum = __atomic_load_n(&m_totals.signalSum, __ATOMIC_RELAXED);
+	totals.noiseSum = __atomic_load_n(&m_totals.noiseSum, __ATOMIC_RELAXED);
+}
+
+void LIDAR_Lite_v3_Metrics::window(Window &window, uint64_t now) const
+{
+	/* Epochs are numbered from the reader's clock, so a stalled writer ages out of the window */
+	uint64_t current = now > m_startNs ? (now - m_startNs) / m_epochNs : 0;
+	uint64_t oldest = current >= EPOCHS - 1 ? m_startNs + (current - EPOCHS + 1) * m_epochNs : m_startNs;
+
+	window.durationNs = now > oldest ? now - oldest : 0;
+	window.samples = window.invalid = window.biased = window.failures = 0;
+	window.distance.clear();
+	window.signal.clear();
+	window.noise.clear();
+
+	for (uint8_t i = 0; i < EPOCHS; i++)
+	{
+		const Epoch &epoch = m_epochs[i];
+		uint64_t id = __atomic_load_n(&epoch.id, __ATOMIC_ACQUIRE);
+		if (id > current || current - id >= EPOCHS)
+			continue;
+
+		uint32_t samples = __atomic_load_n(&epoch.samples, __ATOMIC_RELAXED);
+		uint32_t invalid = __atomic_load_n(&epoch.invalid, __ATOMIC_RELAXED);
+		uint32_t biased = __atomic_load_n(&epoch.biased, __ATOMIC_RELAXED);
+		uint32_t failures = __atomic_load_n(&epoch.failures, __ATOMIC_RELAXED);
+		DistanceSketch distance;
+		LevelSketch signal, noise;
+		distance.accumulate(epoch.distance);
+		signal.accumulate(epoch.signal);
+		noise.accumulate(epoch.noise);
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&epoch.id, __ATOMIC_RELAXED) != id)
+			continue;
+
+		window.samples += samples;
+		window.invalid += invalid;
+		window.biased += biased;
+		window.failures += failures;
+		window.distance.accumulate(distance);
+		window.signal.accumulate(signal);
+		window.noise.accumulate(noise);
+	}
+
+	window.hz = window.durationNs ? window.samples * 1e9 / window.durationNs : 0.0;
+	window.invalidRate = window.samples ? (double)window.invalid / window.samples : 0.0;
+}
+
+/* Buffered writer for the exposition text */
+class LIDAR_Lite_v3_MetricsWriter
+{
+public:
+	LIDAR_Lite_v3_MetricsWriter(int fd) : m_fd(fd), m_used(0), m_ok(true) {}
+
+	void printf(const char *format, ...)
+	{
+		for (int attempt = 0; attempt < 2 && m_ok; attempt++)
+		{
+			va_list args;
+			va_start(args, format);
+			int n = vsnprintf(m_data + m_used, sizeof(m_data) - m_used, format, args);
+			va_end(args);
+			if (n < 0)
+				m_ok = false;
+			else if ((size_t)n < sizeof(m_data) - m_used)
+			{
+				m_used += n;
+				return;
+			}
+			else
+				flush();
+		}
+		/* Line longer than the buffer */
+		m_ok = false;
+	}
+
+	bool flush()
+	{
+		size_t done = 0;
+		while (m_ok && done < m_used)
+		{
+			ssize_t n = send(m_fd, m_data + done, m_used - done, MSG_NOSIGNAL);
+			if (n < 0 && errno == ENOTSOCK)
+				n = ::write(m_fd, m_data + done, m_used - done);
+			if (n <= 0)
+				m_ok = false;
+			else
+				done += n;
+		}
+		m_used = 0;
+		return m_ok;
+	}
+
+private:
+	int m_fd;
+	size_t m_used;
+	bool m_ok;
+	char m_data[4096];
+};
+
+LIDAR_Lite_v3_MetricsServer::LIDAR_Lite_v3_MetricsServer()
+	: m_count(0), m_fd(-1), m_running(false), m_stop(0)
+{
+	m_path[0] = 0;
+}
+
+LIDAR_Lite_v3_MetricsServer::~LIDAR_Lite_v3_MetricsServer()
+{
+	stop();
+	close();
+}
+
+bool LIDAR_Lite_v3_MetricsServer::add(const char *sensor, const LIDAR_Lite_v3_Metrics &metrics)
+{
+	/* Names go verbatim into sensor="..." labels, refuse the characters the text format would need escaped */
+	if (m_running || m_count >= MAX_SENSORS || !sensor || strpbrk(sensor, "\\\"\n"))
+		return false;
+	m_names[m_count] = sensor;
+	m_metrics[m_count] = &metrics;
+	m_count++;
+	return true;
+}
+
+bool LIDAR_Lite_v3_MetricsServer::open(const char *path)
+{
+	close();
+	struct sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(address.sun_path) || strlen(path) >= sizeof(m_path))
+		return false;
+	strcpy(address.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+		return false;
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	unlink(path);
+	if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, 8) != 0)
+	{
+		::close(fd);
+		return false;
+	}
+	m_fd = fd;
+	strcpy(m_path, path);
+	return true;
+}
+
+void LIDAR_Lite_v3_MetricsServer::close()
+{
+	if (m_fd < 0)
+		return;
+	::close(m_fd);
+	unlink(m_path);
+	m_fd = -1;
+	m_path[0] = 0;
+}
+
+int LIDAR_Lite_v3_MetricsServer::serve(int timeoutMs)
+{
+	if (m_fd < 0)
+		return 0;
+	struct pollfd pfd;
+	pfd.fd = m_fd;
+	pfd.events = POLLIN;
+	if (poll(&pfd, 1, timeoutMs) <= 0)
+		return 0;
+
+	int served = 0;
+	for (;;)
+	{
+		int client = accept(m_fd, 0, 0);
+		if (client < 0)
+			break;
+		answer(client);
+		::close(client);
+		served++;
+	}
+	return served;
+}
+
+void LIDAR_Lite_v3_MetricsServer::answer(int client) const
+{
+	struct timeval timeout;
+	timeout.tv_sec = 0;
+	timeout.tv_usec = CLIENT_TIMEOUT_MS * 1000;
+	setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+	setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	/* Clients that send nothing (socat, nc) get the bare text after the timeout */
+	char request[512];
+	ssize_t n = recv(client, request, sizeof(request), 0);
+	if (n >= 4 && memcmp(request, "GET ", 4) == 0)
+	{
+		static const char header[] = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nConnection: close\r\n\r\n";
+		if (send(client, header, sizeof(header) - 1, MSG_NOSIGNAL) != (ssize_t)(sizeof(header) - 1))
+			return;
+	}
+	write(client);
+	shutdown(client, SHUT_WR);
+}
+
+bool LIDAR_Lite_v3_MetricsServer::write(int fd, uint64_t now) const
+{
+	static const double QUANTILES[] = { 0.5, 0.9, 0.99 };
+	static const unsigned QUANTILE_COUNT = sizeof(QUANTILES) / sizeof(QUANTILES[0]);
+
+	LIDAR_Lite_v3_Metrics::Totals totals[MAX_SENSORS];
+	LIDAR_Lite_v3_Metrics::Window windows[MAX_SENSORS];
+	for (uint8_t i = 0; i < m_count; i++)
+	{
+		m_metrics[i]->totals(totals[i]);
+		m_metrics[i]->window(windows[i], now);
+	}
+
+	LIDAR_Lite_v3_MetricsWriter out(fd);
+	uint8_t i;
+
+	out.printf("# HELP lidar_samples_total Measurements taken.\n# TYPE lidar_samples_total counter\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_samples_total{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].samples);
+	out.printf("# HELP lidar_invalid_total Measurements with STATUS InvalidSignalFlag set.\n# TYPE lidar_invalid_total counter\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_invalid_total{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].invalid);
+	out.printf("# HELP lidar_bias_corrections_total Measurements taken with receiver bias correction.\n# TYPE lidar_bias_corrections_total counter\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_bias_corrections_total{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].biased);
+	out.printf("# HELP lidar_failures_total Measurements abandoned while the device stayed busy.\n# TYPE lidar_failures_total counter\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_failures_total{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].failures);
+
+	out.printf("# HELP lidar_window_seconds Length of the rolling window.\n# TYPE lidar_window_seconds gauge\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_window_seconds{sensor=\"%s\"} %.3f\n", m_names[i], windows[i].durationNs / 1e9);
+	out.printf("# HELP lidar_rate_hertz Measurement rate over the window.\n# TYPE lidar_rate_hertz gauge\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_rate_hertz{sensor=\"%s\"} %.3f\n", m_names[i], windows[i].hz);
+	out.printf("# HELP lidar_invalid_ratio Share of invalid measurements over the window.\n# TYPE lidar_invalid_ratio gauge\n");
+	for (i = 0; i < m_count; i++)
+		out.printf("lidar_invalid_ratio{sensor=\"%s\"} %.6f\n", m_names[i], windows[i].invalidRate);
+
+	/* Summaries: quantiles over the window, sum and count cumulative */
+	out.printf("# HELP lidar_distance_centimeters Distance of valid measurements.\n# TYPE lidar_distance_centimeters summary\n");
+	for (i = 0; i < m_count; i++)
+	{
+		for (unsigned q = 0; q < QUANTILE_COUNT; q++)
+			out.printf("lidar_distance_centimeters{sensor=\"%s\",quantile=\"%g\"} %u\n", m_names[i], QUANTILES[q], windows[i].distance.quantile(QUANTILES[q]));
+		out.printf("lidar_distance_centimeters_sum{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].distanceSum);
+		out.printf("lidar_distance_centimeters_count{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)(totals[i].samples - totals[i].invalid));
+	}
+	out.printf("# HELP lidar_signal_strength SIGNAL_STRENGTH register.\n# TYPE lidar_signal_strength summary\n");
+	for (i = 0; i < m_count; i++)
+	{
+		for (unsigned q = 0; q < QUANTILE_COUNT; q++)
+			out.printf("lidar_signal_strength{sensor=\"%s\",quantile=\"%g\"} %u\n", m_names[i], QUANTILES[q], windows[i].signal.quantile(QUANTILES[q]));
+		out.printf("lidar_signal_strength_sum{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].signalSum);
+		out.printf("lidar_signal_strength_count{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].samples);
+	}
+	out.printf("# HELP lidar_noise_peak NOISE_PEAK register.\n# TYPE lidar_noise_peak summary\n");
+	for (i = 0; i < m_count; i++)
+	{
+		for (unsigned q = 0; q < QUANTILE_COUNT; q++)
+			out.printf("lidar_noise_peak{sensor=\"%s\",quantile=\"%g\"} %u\n", m_names[i], QUANTILES[q], windows[i].noise.quantile(QUANTILES[q]));
+		out.printf("lidar_noise_peak_sum{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].noiseSum);
+		out.printf("lidar_noise_peak_count{sensor=\"%s\"} %llu\n", m_names[i], (unsigned long long)totals[i].samples);
+	}
+
+	return out.flush();
+}
+
+bool LIDAR_Lite_v3_MetricsServer::start()
+{
+	if (m_running || m_fd < 0)
+		return false;
+	__atomic_store_n(&m_stop, 0, __ATOMIC_RELAXED);
+	m_running = pthread_create(&m_thread, 0, run, this) == 0;
+	return m_running;
+}
+
+void LIDAR_Lite_v3_MetricsServer::stop()
+{
+	if (!m_running)
+		return;
+	__atomic_store_n(&m_stop, 1, __ATOMIC_RELAXED);
+	pthread_join(m_thread, 0);
+	m_running = false;
+}
+
+void *LIDAR_Lite_v3_MetricsServer::run(void *arg)
+{
+	LIDAR_Lite_v3_MetricsServer &self = *(LIDAR_Lite_v3_MetricsServer *)arg;
+	while (!__atomic_load_n(&self.m_stop, __ATOMIC_RELAXED))
+		self.serve(100);
+	return 0;
+}
@@ -0,0 +1,237 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Metrics.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_METRICS_HPP
+#define LIDAR_LITE_V3_METRICS_HPP
+
+#include <pthread.h>
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+/*
+ * Fixed memory quantile sketch over BITS bit values. Log2 buckets split into SUB_BUCKETS linear
+ * steps, so a quantile is within 1/SUB_BUCKETS of the true value. add() is meant for a single
+ * writer, counts are stored with relaxed atomics so other threads may accumulate() concurrently.
+ */
+template <unsigned BITS>
+class LIDAR_Lite_v3_Sketch
+{
+public:
+	static const unsigned SUB_BITS = 4;
+	static const unsigned SUB_BUCKETS = 1 << SUB_BITS;
+	static const unsigned BUCKETS = (BITS - SUB_BITS + 1) * SUB_BUCKETS;
+
+	LIDAR_Lite_v3_Sketch() { clear(); }
+
+	void clear()
+	{
+		for (unsigned i = 0; i < BUCKETS; i++)
+			__atomic_store_n(&m_counts[i], 0, __ATOMIC_RELAXED);
+	}
+
+	void add(uint32_t value)
+	{
+		uint32_t *count = &m_counts[bucket(value)];
+		__atomic_store_n(count, __atomic_load_n(count, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+	}
+
+	/* Add the counts of a sketch that may be updated by another thread */
+	void accumulate(const LIDAR_Lite_v3_Sketch &other)
+	{
+		for (unsigned i = 0; i < BUCKETS; i++)
+			m_counts[i] += __atomic_load_n(&other.m_counts[i], __ATOMIC_RELAXED);
+	}
+
+	uint64_t count() const
+	{
+		uint64_t count = 0;
+		for (unsigned i = 0; i < BUCKETS; i++)
+			count += m_counts[i];
+		return count;
+	}
+
+	/* Upper bound of the bucket holding quantile q (0..1), 0 if empty */
+	uint32_t quantile(double q) const
+	{
+		uint64_t total = count();
+		if (total == 0)
+			return 0;
+		uint64_t rank = (uint64_t)(q * total + 0.5);
+		if (rank == 0)
+			rank = 1;
+		uint64_t seen = 0;
+		for (unsigned i = 0; i < BUCKETS; i++)
+		{
+			seen += m_counts[i];
+			if (seen >= rank)
+				return upperBound(i);
+		}
+		return upperBound(BUCKETS - 1);
+	}
+
+private:
+	static unsigned bucket(uint32_t value)
+	{
+		if (value < SUB_BUCKETS)
+			return value;
+		unsigned msb = BITS - 1;
+		while (!(value >> msb))
+			msb--;
+		unsigned shift = msb - SUB_BITS;
+		return (shift + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+	}
+
+	static uint32_t upperBound(unsigned i)
+	{
+		if (i < SUB_BUCKETS)
+			return i;
+		unsigned shift = i / SUB_BUCKETS - 1;
+		return ((SUB_BUCKETS + i % SUB_BUCKETS) << shift) + (1u << shift) - 1;
+	}
+
+	uint32_t m_counts[BUCKETS];
+};
+
+/*
+ * Streaming statistics of one sensor. The acquisition loop calls add() for every measurement;
+ * it takes no locks and runs in constant time (a rotation clears at most EPOCHS epochs).
+ *
+ * Samples go into EPOCHS time slots of epochNs each; the rolling window is the current, partial
+ * epoch plus the EPOCHS - 1 before it. Totals are cumulative. Any thread may call totals() and
+ * window() while the writer is running, an epoch rotated during the read is left out.
+ */
+class LIDAR_Lite_v3_Metrics
+{
+public:
+	static const uint8_t EPOCHS = 8;
+
+	typedef LIDAR_Lite_v3_Sketch<16> DistanceSketch; // centimeters
+	typedef LIDAR_Lite_v3_Sketch<8> LevelSketch;     // SIGNAL_STRENGTH, NOISE_PEAK
+
+	struct Totals
+	{
+		uint64_t samples;
+		uint64_t invalid;  // STATUS InvalidSignalFlag set
+		uint64_t biased;   // receiver bias corrections
+		uint64_t failures; // device stayed busy
+		uint64_t distanceSum;
+		uint64_t signalSum;
+		uint64_t noiseSum;
+	};
+
+	struct Window
+	{
+		uint64_t durationNs;
+		uint32_t samples;
+		uint32_t invalid;
+		uint32_t biased;
+		uint32_t failures;
+		double hz;
+		double invalidRate;
+		DistanceSketch distance;
+		LevelSketch signal;
+		LevelSketch noise;
+	};
+
+	LIDAR_Lite_v3_Metrics(uint64_t epochNs=1000000000ull, uint64_t now=LIDAR_Lite_v3_Clock::now());
+
+	/* Record one measurement and the NOISE_PEAK read with it */
+	void add(const LIDAR_Lite_v3_Measurement &measurement, uint8_t noisePeak, bool biased, uint64_t now=LIDAR_Lite_v3_Clock::now());
+	/* Record a measurement abandoned while the device stayed busy */
+	void addFailure(uint64_t now=LIDAR_Lite_v3_Clock::now());
+
+	void totals(Totals &totals) const;
+	void window(Window &window, uint64_t now=LIDAR_Lite_v3_Clock::now()) const;
+
+	uint64_t epochNs() const { return m_epochNs; }
+
+private:
+	LIDAR_Lite_v3_Metrics(const LIDAR_Lite_v3_Metrics &);
+	LIDAR_Lite_v3_Metrics &operator=(const LIDAR_Lite_v3_Metrics &);
+
+	struct Epoch
+	{
+		uint64_t id; // epoch number the counts belong to
+		uint32_t samples;
+		uint32_t invalid;
+		uint32_t biased;
+		uint32_t failures;
+		DistanceSketch distance;
+		LevelSketch signal;
+		LevelSketch noise;
+	};
+
+	Epoch &advance(uint64_t now);
+
+	static void increment(uint32_t &counter) { __atomic_store_n(&counter, counter + 1, __ATOMIC_RELAXED); }
+	static void increment(uint64_t &counter, uint64_t value=1) { __atomic_store_n(&counter, counter + value, __ATOMIC_RELAXED); }
+
+	uint64_t m_epochNs;
+	uint64_t m_startNs;
+	uint64_t m_current;
+	Totals m_totals;
+	Epoch m_epochs[EPOCHS];
+};
+
+/*
+ * Serves the metrics of registered sensors in Prometheus text format on a Unix domain socket.
+ * A client that sends an HTTP request gets an HTTP response, anything else gets the bare text,
+ * so both `curl --unix-socket` and `socat` work. Sensor names and metrics are owned by the
+ * caller and must outlive the server.
+ */
+class LIDAR_Lite_v3_MetricsServer
+{
+public:
+	static const uint8_t MAX_SENSORS = 32;
+	/* Per client limit for reading the request and writing the response */
+	static const int CLIENT_TIMEOUT_MS = 100;
+
+	LIDAR_Lite_v3_MetricsServer();
+	~LIDAR_Lite_v3_MetricsServer();
+
+	/* Register a sensor, before start(). Names containing a backslash, double quote or newline are refused. */
+	bool add(const char *sensor, const LIDAR_Lite_v3_Metrics &metrics);
+
+	/* Listen on path, replacing a stale socket file */
+	bool open(const char *path);
+	void close();
+	/* Listening socket for an external poll loop, -1 if closed */
+	int fd() const { return m_fd; }
+
+	/* Answer pending clients, waiting up to timeoutMs for the first. Returns the number served. */
+	int serve(int timeoutMs);
+
+	/* Run serve() on a dedicated thread */
+	bool start();
+	void stop();
+
+	/* Write the exposition text, returns false on a write error */
+	bool write(int fd, uint64_t now=LIDAR_Lite_v3_Clock::now()) const;
+
+private:
+	LIDAR_Lite_v3_MetricsServer(const LIDAR_Lite_v3_MetricsServer &);
+	LIDAR_Lite_v3_MetricsServer &operator=(const LIDAR_Lite_v3_MetricsServer &);
+
+	void answer(int client) const;
+	static void *run(void *arg);
+
+	const char *m_names[MAX_SENSORS];
+	const LIDAR_Lite_v3_Metrics *m_metrics[MAX_SENSORS];
+	uint8_t m_count;
+	int m_fd;
+	char m_path[108];
+	pthread_t m_thread;
+	bool m_running;
+	int m_stop;
+};
+
+#endif /* LIDAR_LITE_V3_METRICS_HPP */
@@ -0,0 +1,104 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-MultiReturn.cpp
+ */
+
+#include "LIDAR-Lite-v3-MultiReturn.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_MultiReturn::LIDAR_Lite_v3_MultiReturn(LIDAR_Lite_v3_Base &device, uint16_t binMm, uint8_t minSeparation)
+	: m_device(device), m_batch(device), m_binMm(DEFAULT_BIN_MM), m_minSeparation(minSeparation)
+{
+	this->binMm(binMm);
+}
+
+bool LIDAR_Lite_v3_MultiReturn::binMm(uint16_t binMm)
+{
+	if (binMm == 0 || binMm > MAX_BIN_MM)
+		return false;
+	m_binMm = binMm;
+	return true;
+}
+
+void LIDAR_Lite_v3_MultiReturn::readRecord(LIDAR_Lite_v3_Base &device, int16_t *record)
+{
+	device.setACQ_SETTINGS(B::ACQ_SETTINGS::Bank::BANK << 6);
+	device.setCOMMAND(B::COMMAND::TestMode::ENABLE);
+	for (uint16_t i = 0; i < RECORD_SIZE; i++)
+	{
+		uint16_t data = device.read16(B::CORR_DATA::__address, 16);
+		uint8_t low = (uint8_t)(data >> 8), sign = (uint8_t)data;
+		record[i] = (int16_t)((sign & 0x01) ? (0xff00 | low) : low);
+	}
+	device.setCOMMAND(B::COMMAND::TestMode::DISABLE);
+}
+
+bool LIDAR_Lite_v3_MultiReturn::measure(LIDAR_Lite_v3_Returns &out)
+{
+	out.hasSecondary = false;
+	out.secondaryDistance = 0;
+	out.peakBck = 0;
+	out.primaryPeak = 0;
+	out.secondaryPeak = 0;
+	out.relativeStrength = 0;
+
+	if (!m_batch.measure(out.primary))
+		return false;
+	if ((out.primary.status & B::STATUS::SecondaryReturnFlag::mask) == 0)
+		return true;
+	out.peakBck = m_device.getPEAK_BCK();
+	if (out.peakBck == 0)
+		return true;
+
+	readRecord(m_device, m_record);
+
+	uint16_t p = 0;
+	for (uint16_t i = 1; i < RECORD_SIZE; i++)
+		if (m_record[i] > m_record[p])
+			p = i;
+
+	/* Extent of the primary lobe, widened by the minimum separation */
+	uint16_t lo = p, hi = p;
+	while (lo > 0 && m_record[lo - 1] < m_record[lo])
+		lo--;
+	while (hi < RECORD_SIZE - 1 && m_record[hi + 1] < m_record[hi])
+		hi++;
+	lo = lo > m_minSeparation ? lo - m_minSeparation : 0;
+	hi = hi + m_minSeparation < RECORD_SIZE ? hi + m_minSeparation : RECORD_SIZE - 1;
+
+	/* Local maximum outside the primary lobe that best matches PEAK_BCK, the higher one on a tie */
+	int32_t s = -1;
+	int32_t best = 0;
+	for (uint16_t i = 1; i < RECORD_SIZE - 1; i++)
+	{
+		if (i >= lo && i <= hi)
+			continue;
+		if (m_record[i] < m_record[i - 1] || m_record[i] < m_record[i + 1])
+			continue;
+		int32_t error = m_record[i] - (int32_t)out.peakBck;
+		error = error < 0 ? -error : error;
+		if (s < 0 || error < best || (error == best && m_record[i] > m_record[s]))
+		{
+			s = i;
+			best = error;
+		}
+	}
+
+	out.primaryPeak = m_record[p];
+	if (s < 0 || m_record[s] <= 0 || m_record[p] <= 0)
+		return true;
+
+	int32_t distance = (int32_t)out.primary.distance + (s - (int32_t)p) * m_binMm / 10;
+	out.hasSecondary = true;
+	out.secondaryDistance = distance > 0 ? (uint16_t)distance : 0;
+	out.secondaryPeak = m_record[s];
+	out.relativeStrength = (uint8_t)((int32_t)m_record[s] * 255 / m_record[p]);
+	return true;
+}
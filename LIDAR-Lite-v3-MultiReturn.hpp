@@ -0,0 +1,74 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-MultiReturn.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_MULTIRETURN_HPP
+#define LIDAR_LITE_V3_MULTIRETURN_HPP
+
+#include "LIDAR-Lite-v3-Batch.hpp"
+
+/* Primary and, if flagged, secondary return of one measurement */
+struct LIDAR_Lite_v3_Returns
+{
+	LIDAR_Lite_v3_Measurement primary;
+	bool hasSecondary;
+	uint16_t secondaryDistance; // centimeters
+	uint8_t peakBck;            // PEAK_BCK, second highest correlation peak as reported by the device
+	int16_t primaryPeak;        // correlation value at the primary peak
+	int16_t secondaryPeak;      // correlation value at the secondary peak
+	uint8_t relativeStrength;   // secondaryPeak * 255 / primaryPeak
+};
+
+/*
+ * Multi-target extraction. Unflagged samples cost the same as LIDAR_Lite_v3_Batch::measure(). When
+ * STATUS::SecondaryReturnFlag is set PEAK_BCK is read, and only if it reports a second peak is the
+ * correlation record downloaded. The secondary return is the local maximum outside the primary lobe
+ * closest in value to PEAK_BCK.
+ * The secondary range is placed relative to FULL_DELAY using binMm, the distance covered by one
+ * correlation record entry. The default is nominal and should be calibrated against a known target.
+ */
+class LIDAR_Lite_v3_MultiReturn
+{
+public:
+	/* Correlation record entries downloaded per flagged sample */
+	static const uint16_t RECORD_SIZE = 256;
+	/* Nominal distance per correlation record entry and the accepted range */
+	static const uint16_t DEFAULT_BIN_MM = 150;
+	static const uint16_t MAX_BIN_MM = 1000;
+
+	/* An out of range binMm falls back to DEFAULT_BIN_MM */
+	LIDAR_Lite_v3_MultiReturn(LIDAR_Lite_v3_Base &device, uint16_t binMm=DEFAULT_BIN_MM, uint8_t minSeparation=4);
+
+	/* Set the calibrated distance per record entry, false if not within 1..MAX_BIN_MM */
+	bool binMm(uint16_t binMm);
+	uint16_t binMm() const { return m_binMm; }
+
+	/* Take one measurement, extract the secondary return if flagged. Returns false if the device stayed busy. */
+	bool measure(LIDAR_Lite_v3_Returns &out);
+
+	/* Correlation record of the last flagged sample */
+	const int16_t *record() const { return m_record; }
+
+	/*
+	 * Download RECORD_SIZE sign extended correlation record entries through COMMAND TestMode. Each entry
+	 * is one read16() of CORR_DATA and CORR_DATA_SIGN: the memory index advances on every read, so the
+	 * two bytes must come from a single transaction.
+	 */
+	static void readRecord(LIDAR_Lite_v3_Base &device, int16_t *record);
+
+private:
+	LIDAR_Lite_v3_Base &m_device;
+	LIDAR_Lite_v3_Batch m_batch;
+	uint16_t m_binMm;
+	uint8_t m_minSeparation;
+	int16_t m_record[RECORD_SIZE];
+};
+
+#endif /* LIDAR_LITE_V3_MULTIRETURN_HPP */
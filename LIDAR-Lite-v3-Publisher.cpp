@@ -0,0 +1,80 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Publisher.cpp
+ */
+
+#include "LIDAR-Lite-v3-Publisher.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+#include <time.h>
+
+LIDAR_Lite_v3_Publisher::LIDAR_Lite_v3_Publisher(LIDAR_Lite_v3_Base &device)
+	: m_timestamper(device), m_sequence(0), m_periodNs(0), m_running(false), m_stop(0)
+{
+	LIDAR_Lite_v3_Sample empty;
+	memset(&empty, 0, sizeof(empty));
+	m_latest.write(empty);
+}
+
+LIDAR_Lite_v3_Publisher::~LIDAR_Lite_v3_Publisher()
+{
+	stop();
+}
+
+bool LIDAR_Lite_v3_Publisher::step()
+{
+	LIDAR_Lite_v3_Sample sample;
+	if (!m_timestamper.measure(sample.data))
+		return false;
+	sample.sequence = ++m_sequence;
+	m_latest.write(sample);
+	return true;
+}
+
+bool LIDAR_Lite_v3_Publisher::start(uint64_t periodNs)
+{
+	if (m_running)
+		return false;
+	m_periodNs = periodNs;
+	__atomic_store_n(&m_stop, 0, __ATOMIC_RELAXED);
+	m_running = pthread_create(&m_thread, 0, run, this) == 0;
+	return m_running;
+}
+
+void LIDAR_Lite_v3_Publisher::stop()
+{
+	if (!m_running)
+		return;
+	__atomic_store_n(&m_stop, 1, __ATOMIC_RELAXED);
+	pthread_join(m_thread, 0);
+	m_running = false;
+}
+
+void *LIDAR_Lite_v3_Publisher::run(void *arg)
+{
+	LIDAR_Lite_v3_Publisher &self = *(LIDAR_Lite_v3_Publisher *)arg;
+	uint64_t next = LIDAR_Lite_v3_Clock::now();
+	while (!__atomic_load_n(&self.m_stop, __ATOMIC_RELAXED))
+	{
+		self.step();
+		if (self.m_periodNs)
+		{
+			/* Skip missed periods rather than bursting to catch up */
+			uint64_t now = LIDAR_Lite_v3_Clock::now();
+			next += self.m_periodNs;
+			if (next < now)
+				next = now;
+			struct timespec ts;
+			ts.tv_sec = next / 1000000000ull;
+			ts.tv_nsec = next % 1000000000ull;
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0);
+		}
+	}
+	return 0;
+}
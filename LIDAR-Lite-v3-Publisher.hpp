@@ -0,0 +1,167 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Publisher.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_PUBLISHER_HPP
+#define LIDAR_LITE_V3_PUBLISHER_HPP
+
+#include <cstring>
+#include <pthread.h>
+#include "LIDAR-Lite-v3-Timestamp.hpp"
+
+/*
+ * Copies a plain value to and from memory that is written and read concurrently under a sequence
+ * word, through relaxed atomic 64 bit words so the accesses are race free. Fences and the sequence
+ * word itself are up to the caller. Uses the GCC/Clang __atomic builtins.
+ */
+template <typename T>
+struct LIDAR_Lite_v3_AtomicWords
+{
+	static const unsigned WORDS = (sizeof(T) + 7) / 8;
+
+	static void store(uint64_t *words, const T &value)
+	{
+		uint64_t copy[WORDS];
+		memset(copy, 0, sizeof(copy));
+		memcpy(copy, &value, sizeof(T));
+		for (unsigned i = 0; i < WORDS; i++)
+			__atomic_store_n(&words[i], copy[i], __ATOMIC_RELAXED);
+	}
+
+	static void load(T &value, const uint64_t *words)
+	{
+		uint64_t copy[WORDS];
+		for (unsigned i = 0; i < WORDS; i++)
+			copy[i] = __atomic_load_n(&words[i], __ATOMIC_RELAXED);
+		memcpy(&value, copy, sizeof(T));
+	}
+};
+
+/*
+ * Single writer sequence lock. The writer never blocks, readers retry while a write is in
+ * progress and never touch the writer's state. The payload is copied with LIDAR_Lite_v3_AtomicWords
+ * so concurrent reads are race free.
+ */
+template <typename T>
+class LIDAR_Lite_v3_SeqLock
+{
+public:
+	LIDAR_Lite_v3_SeqLock() : m_seq(0) { memset(m_words, 0, sizeof(m_words)); }
+
+	void write(const T &value)
+	{
+		uint32_t seq = __atomic_load_n(&m_seq, __ATOMIC_RELAXED);
+		__atomic_store_n(&m_seq, seq + 1, __ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+		LIDAR_Lite_v3_AtomicWords<T>::store(m_words, value);
+		__atomic_store_n(&m_seq, seq + 2, __ATOMIC_RELEASE);
+	}
+
+	/* Single attempt, false if a write was in progress */
+	bool tryRead(T &value) const
+	{
+		uint32_t before = __atomic_load_n(&m_seq, __ATOMIC_ACQUIRE);
+		if (before & 1)
+			return false;
+		T copy;
+		LIDAR_Lite_v3_AtomicWords<T>::load(copy, m_words);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&m_seq, __ATOMIC_RELAXED) != before)
+			return false;
+		value = copy;
+		return true;
+	}
+
+	void read(T &value) const
+	{
+		while (!tryRead(value))
+			;
+	}
+
+private:
+	static const unsigned WORDS = LIDAR_Lite_v3_AtomicWords<T>::WORDS;
+
+	uint32_t m_seq;
+	uint64_t m_words[WORDS];
+};
+
+/* Published sample, sequence counts acquisitions from 1 */
+struct LIDAR_Lite_v3_Sample
+{
+	uint64_t sequence;
+	LIDAR_Lite_v3_TimedMeasurement data;
+};
+
+/*
+ * Single acquisition owner for many in-process readers. Only the publisher touches the bus,
+ * readers get the latest sample from a sequence lock, so bus load does not grow with readers.
+ * Drive it with step() from an existing loop, or start() a dedicated thread.
+ */
+class LIDAR_Lite_v3_Publisher
+{
+public:
+	LIDAR_Lite_v3_Publisher(LIDAR_Lite_v3_Base &device);
+	~LIDAR_Lite_v3_Publisher();
+
+	/* Take and publish one measurement. Returns false if the device stayed busy. */
+	bool step();
+
+	/* Run step() on a dedicated thread, periodNs apart (0: back to back) */
+	bool start(uint64_t periodNs=0);
+	void stop();
+
+	/* Latest sample, sequence 0 before the first acquisition */
+	void latest(LIDAR_Lite_v3_Sample &sample) const { m_latest.read(sample); }
+
+	LIDAR_Lite_v3_Timestamper &timestamper() { return m_timestamper; }
+
+private:
+	LIDAR_Lite_v3_Publisher(const LIDAR_Lite_v3_Publisher &);
+	LIDAR_Lite_v3_Publisher &operator=(const LIDAR_Lite_v3_Publisher &);
+
+	static void *run(void *arg);
+
+	LIDAR_Lite_v3_Timestamper m_timestamper;
+	LIDAR_Lite_v3_SeqLock<LIDAR_Lite_v3_Sample> m_latest;
+	uint64_t m_sequence;
+	uint64_t m_periodNs;
+	pthread_t m_thread;
+	bool m_running;
+	int m_stop;
+};
+
+/* Per reader view of a publisher, tracks missed samples */
+class LIDAR_Lite_v3_Subscriber
+{
+public:
+	LIDAR_Lite_v3_Subscriber(const LIDAR_Lite_v3_Publisher &publisher) : m_publisher(publisher), m_last(0), m_missed(0) {}
+
+	/* Read the latest sample, returns true if it is newer than the previous read */
+	bool read(LIDAR_Lite_v3_Sample &sample)
+	{
+		m_publisher.latest(sample);
+		if (sample.sequence == m_last)
+			return false;
+		if (m_last && sample.sequence > m_last + 1)
+			m_missed += sample.sequence - m_last - 1;
+		m_last = sample.sequence;
+		return true;
+	}
+
+	/* Samples published but never seen by this reader */
+	uint64_t missed() const { return m_missed; }
+
+private:
+	const LIDAR_Lite_v3_Publisher &m_publisher;
+	uint64_t m_last;
+	uint64_t m_missed;
+};
+
+#endif /* LIDAR_LITE_V3_PUBLISHER_HPP */
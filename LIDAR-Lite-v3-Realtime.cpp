@@ -0,0 +1,192 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Realtime.cpp
+ */
+
+#include "LIDAR-Lite-v3-Realtime.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+#include <cerrno>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_RealtimeRunner::LIDAR_Lite_v3_RealtimeRunner(LIDAR_Lite_v3_Base &device, uint64_t periodNs, uint8_t biasInterval)
+	: m_device(device), m_periodNs(periodNs ? periodNs : 1), m_trigger(biasInterval),
+	  m_pending(false), m_issued(0), m_sequence(0), m_lockMemory(false),
+	  m_cycles(0), m_samples(0), m_notReady(0), m_overruns(0), m_skipped(0), m_running(false), m_stop(0)
+{
+	LIDAR_Lite_v3_RealtimeSample empty;
+	memset(&empty, 0, sizeof(empty));
+	m_latest.write(empty);
+}
+
+LIDAR_Lite_v3_RealtimeRunner::~LIDAR_Lite_v3_RealtimeRunner()
+{
+	stop();
+}
+
+bool LIDAR_Lite_v3_RealtimeRunner::start(int priority, int cpu, bool lockMemory)
+{
+	if (m_running)
+		return false;
+	/* Process wide and left in place after stop(), unlocking could fault in pages under other threads */
+	if (lockMemory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+		return false;
+	m_lockMemory = lockMemory;
+
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	bool ok = pthread_attr_setstacksize(&attr, STACK_SIZE) == 0;
+	if (ok && priority > 0)
+	{
+		struct sched_param param;
+		param.sched_priority = priority;
+		ok = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED) == 0
+			&& pthread_attr_setschedpolicy(&attr, SCHED_FIFO) == 0
+			&& pthread_attr_setschedparam(&attr, &param) == 0;
+	}
+	if (ok && cpu >= 0)
+	{
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		ok = pthread_attr_setaffinity_np(&attr, sizeof(set), &set) == 0;
+	}
+	if (ok)
+	{
+		m_pending = false;
+		__atomic_store_n(&m_stop, 0, __ATOMIC_RELAXED);
+		m_running = pthread_create(&m_thread, &attr, run, this) == 0;
+		ok = m_running;
+	}
+	pthread_attr_destroy(&attr);
+	return ok;
+}
+
+void LIDAR_Lite_v3_RealtimeRunner::stop()
+{
+	if (!m_running)
+		return;
+	__atomic_store_n(&m_stop, 1, __ATOMIC_RELAXED);
+	pthread_join(m_thread, 0);
+	m_running = false;
+}
+
+void LIDAR_Lite_v3_RealtimeRunner::cycle(uint64_t wake)
+{
+	if (m_pending)
+	{
+		uint8_t status = m_device.getSTATUS();
+		if (status & B::STATUS::BusyFlag::mask)
+			m_notReady++;
+		else
+		{
+			LIDAR_Lite_v3_RealtimeSample sample;
+			sample.measurement.status = status;
+			sample.measurement.signalStrength = m_device.getSIGNAL_STRENGTH();
+			sample.measurement.distance = m_device.getFULL_DELAY();
+			sample.readout = LIDAR_Lite_v3_Clock::now();
+			sample.issued = m_issued;
+			sample.sequence = ++m_sequence;
+			m_latest.write(sample);
+			m_samples++;
+			m_pending = false;
+		}
+	}
+
+	/* A busy device is read again next cycle rather than triggered twice */
+	if (!m_pending)
+	{
+		m_trigger.fire(m_device);
+		m_issued = LIDAR_Lite_v3_Clock::now();
+		m_pending = true;
+	}
+
+	m_bus.add(LIDAR_Lite_v3_Clock::now() - wake);
+	m_cycles++;
+}
+
+void *LIDAR_Lite_v3_RealtimeRunner::run(void *arg)
+{
+	LIDAR_Lite_v3_RealtimeRunner &self = *(LIDAR_Lite_v3_RealtimeRunner *)arg;
+
+	/* Fault in the stack now so the loop never takes a page fault */
+	if (self.m_lockMemory)
+	{
+		volatile char stack[STACK_SIZE / 2];
+		for (size_t i = 0; i < sizeof(stack); i += 4096)
+			stack[i] = 0;
+	}
+
+	uint64_t next = LIDAR_Lite_v3_Clock::now() + self.m_periodNs;
+	uint64_t lastLate = 0;
+	bool first = true;
+	while (!__atomic_load_n(&self.m_stop, __ATOMIC_RELAXED))
+	{
+		struct timespec ts;
+		ts.tv_sec = next / 1000000000ull;
+		ts.tv_nsec = next % 1000000000ull;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0) == EINTR)
+			;
+
+		uint64_t wake = LIDAR_Lite_v3_Clock::now();
+		uint64_t late = wake > next ? wake - next : 0;
+		self.m_wakeup.add(late);
+		if (!first)
+			self.m_jitter.add(late > lastLate ? late - lastLate : lastLate - late);
+		lastLate = late;
+		first = false;
+
+		self.cycle(wake);
+
+		/* Skip, not queue: a late cycle moves the deadline past now */
+		next += self.m_periodNs;
+		uint64_t end = LIDAR_Lite_v3_Clock::now();
+		if (end > next)
+		{
+			uint64_t missed = (end - next) / self.m_periodNs + 1;
+			self.m_overruns++;
+			self.m_overrun.add(end - next);
+			self.m_skipped += missed;
+			next += missed * self.m_periodNs;
+		}
+	}
+	return 0;
+}
+
+LIDAR_Lite_v3_RealtimeRunner::Report LIDAR_Lite_v3_RealtimeRunner::report() const
+{
+	Report r;
+	r.cycles = m_cycles;
+	r.samples = m_samples;
+	r.notReady = m_notReady;
+	r.overruns = m_overruns;
+	r.skippedPeriods = m_skipped;
+	r.jitterP999Ns = m_jitter.percentile(0.999);
+	r.jitterMaxNs = m_jitter.max();
+	r.wakeupP999Ns = m_wakeup.percentile(0.999);
+	r.busP999Ns = m_bus.percentile(0.999);
+	return r;
+}
+
+void LIDAR_Lite_v3_RealtimeRunner::clearStats()
+{
+	m_cycles = 0;
+	m_samples = 0;
+	m_notReady = 0;
+	m_overruns = 0;
+	m_skipped = 0;
+	m_wakeup.clear();
+	m_bus.clear();
+	m_jitter.clear();
+	m_overrun.clear();
+}
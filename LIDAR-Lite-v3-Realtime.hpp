@@ -0,0 +1,123 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Realtime.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_REALTIME_HPP
+#define LIDAR_LITE_V3_REALTIME_HPP
+
+#include <pthread.h>
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+#include "LIDAR-Lite-v3-Histogram.hpp"
+#include "LIDAR-Lite-v3-Publisher.hpp"
+
+/* Sample delivered by the real-time runner, sequence counts samples from 1 */
+struct LIDAR_Lite_v3_RealtimeSample
+{
+	uint64_t sequence;
+	uint64_t issued;  // CLOCK_MONOTONIC time the acquisition was triggered
+	uint64_t readout; // CLOCK_MONOTONIC time FULL_DELAY was read
+	LIDAR_Lite_v3_Measurement measurement;
+};
+
+/*
+ * Fixed period acquisition on a dedicated real-time thread.
+ *
+ * Every period the thread wakes at an absolute deadline, reads the measurement triggered in the
+ * previous period and triggers the next one, so samples are exactly one period apart and the bus
+ * time per cycle is a few register accesses. A device still busy at readout is never waited for,
+ * it is read again next cycle and not retriggered. A cycle that ends past the next deadline skips
+ * the missed periods instead of running them back to back.
+ *
+ * Jitter is measured against the schedule: the change in wake - deadline from one cycle to the
+ * next, so skipped periods show up in overruns and skippedPeriods, not as jitter.
+ *
+ * The thread runs SCHED_FIFO, optionally pinned to one CPU, with memory locked and its stack
+ * prefaulted. All state is allocated before start(), the loop does not allocate.
+ */
+class LIDAR_Lite_v3_RealtimeRunner
+{
+public:
+	/* Stack of the acquisition thread, prefaulted when memory is locked */
+	static const size_t STACK_SIZE = 256 * 1024;
+
+	struct Report
+	{
+		uint64_t cycles;
+		uint64_t samples;
+		uint64_t notReady;       // device still busy at readout, read again next cycle
+		uint64_t overruns;       // cycles that ended past the next deadline
+		uint64_t skippedPeriods; // periods not run because of overruns
+		uint64_t jitterP999Ns;   // 99.9th percentile of the change in wake - deadline between cycles
+		uint64_t jitterMaxNs;
+		uint64_t wakeupP999Ns;   // 99.9th percentile of wake - deadline
+		uint64_t busP999Ns;      // 99.9th percentile of bus time per cycle
+	};
+
+	LIDAR_Lite_v3_RealtimeRunner(LIDAR_Lite_v3_Base &device, uint64_t periodNs, uint8_t biasInterval=100);
+	~LIDAR_Lite_v3_RealtimeRunner();
+
+	/*
+	 * Start the acquisition thread at SCHED_FIFO priority (0 keeps the default policy), pinned to
+	 * cpu (-1: not pinned). Returns false if a requested attribute cannot be applied, which
+	 * usually means missing CAP_SYS_NICE or CAP_IPC_LOCK.
+	 */
+	bool start(int priority=80, int cpu=-1, bool lockMemory=true);
+	void stop();
+	bool running() const { return m_running; }
+
+	/* Latest sample, sequence 0 before the first one */
+	void latest(LIDAR_Lite_v3_RealtimeSample &sample) const { m_latest.read(sample); }
+
+	/* The histograms and report are only consistent while the runner is stopped */
+	Report report() const;
+	/* wake - deadline */
+	const LIDAR_Lite_v3_Histogram &wakeup() const { return m_wakeup; }
+	/* Bus time per cycle, readout and trigger */
+	const LIDAR_Lite_v3_Histogram &bus() const { return m_bus; }
+	/* |(wake - deadline) - previous (wake - deadline)| between consecutive cycles */
+	const LIDAR_Lite_v3_Histogram &jitter() const { return m_jitter; }
+	/* How far an overrunning cycle ended past the next deadline */
+	const LIDAR_Lite_v3_Histogram &overrun() const { return m_overrun; }
+	void clearStats();
+
+private:
+	LIDAR_Lite_v3_RealtimeRunner(const LIDAR_Lite_v3_RealtimeRunner &);
+	LIDAR_Lite_v3_RealtimeRunner &operator=(const LIDAR_Lite_v3_RealtimeRunner &);
+
+	void cycle(uint64_t wake);
+	static void *run(void *arg);
+
+	LIDAR_Lite_v3_Base &m_device;
+	uint64_t m_periodNs;
+	LIDAR_Lite_v3_Trigger m_trigger;
+	bool m_pending;    // an acquisition was triggered and not yet read
+	uint64_t m_issued;
+	uint64_t m_sequence;
+	bool m_lockMemory;
+
+	uint64_t m_cycles;
+	uint64_t m_samples;
+	uint64_t m_notReady;
+	uint64_t m_overruns;
+	uint64_t m_skipped;
+	LIDAR_Lite_v3_Histogram m_wakeup;
+	LIDAR_Lite_v3_Histogram m_bus;
+	LIDAR_Lite_v3_Histogram m_jitter;
+	LIDAR_Lite_v3_Histogram m_overrun;
+	LIDAR_Lite_v3_SeqLock<LIDAR_Lite_v3_RealtimeSample> m_latest;
+
+	pthread_t m_thread;
+	bool m_running;
+	int m_stop;
+};
+
+#endif /* LIDAR_LITE_V3_REALTIME_HPP */
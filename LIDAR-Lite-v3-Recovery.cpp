@@ -0,0 +1,126 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Recovery.cpp
+ */
+
+#include "LIDAR-Lite-v3-Recovery.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+#include "LIDAR-Lite-v3-Snapshot.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_Recovery::LIDAR_Lite_v3_Recovery(LIDAR_Lite_v3_Base &device)
+	: m_device(device)
+{
+	/*
+	 * Restorable registers are the configuration registers of the register map, in ascending address order.
+	 * I2C_CONFIG is left out: after a reset I2C_ID and I2C_SEC_ADDR are gone, restoring it could disable the
+	 * default address and lock the host out of the bus.
+	 */
+	m_count = 0;
+	for (uint8_t i = 0; i < B::REGISTER_COUNT && m_count < CONFIG_COUNT; i++)
+	{
+		const B::REGISTER_INFO &info = B::REGISTERS[i];
+		if (LIDAR_Lite_v3_Snapshot::isConfig(info) && info.address != B::I2C_CONFIG::__address)
+		{
+			m_config[m_count].address = info.address;
+			m_config[m_count].dflt = info.dflt;
+			m_config[m_count].value = info.dflt;
+			m_count++;
+		}
+	}
+	resetMetrics();
+}
+
+bool LIDAR_Lite_v3_Recovery::set(uint16_t address, uint8_t value)
+{
+	for (uint8_t i = 0; i < m_count; i++)
+	{
+		if (m_config[i].address == address)
+		{
+			m_config[i].value = value;
+			m_device.write(address, value, 8);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool LIDAR_Lite_v3_Recovery::busError()
+{
+	m_metrics.busErrors++;
+	return recover();
+}
+
+bool LIDAR_Lite_v3_Recovery::recover()
+{
+	uint64_t start = LIDAR_Lite_v3_Clock::now();
+
+	m_device.setACQ_COMMAND(B::ACQ_COMMAND::ACQ_COMMAND_::RESET);
+	uint8_t status;
+	bool ok = LIDAR_Lite_v3_Trigger::wait(m_device, status, RESET_POLL_LIMIT);
+
+	if (ok)
+	{
+		/* Only registers that differ from the reset value need rewriting */
+		LIDAR_Lite_v3_Snapshot restored;
+		const Entry *sleep = 0;
+		for (uint8_t i = 0; i < m_count; i++)
+		{
+			if (m_config[i].address == B::POWER_CONTROL::__address && (m_config[i].value & B::POWER_CONTROL::Sleep::mask))
+				sleep = &m_config[i];
+			else if (m_config[i].value != m_config[i].dflt)
+			{
+				m_device.write(m_config[i].address, m_config[i].value, 8);
+				m_metrics.restoredWrites++;
+				restored.set(m_config[i].address, m_config[i].value);
+			}
+		}
+
+		/* Read back only the restored registers, grouped into bursts of nearby addresses */
+		LIDAR_Lite_v3_Snapshot current;
+		current.dump(m_device, restored);
+		uint16_t address;
+		ok = restored.diff(current, &address, 1) == 0;
+
+		/* Put the device back to sleep last, reading it back would wake it up again */
+		if (ok && sleep)
+		{
+			m_device.write(sleep->address, sleep->value, 8);
+			m_metrics.restoredWrites++;
+		}
+	}
+
+	uint64_t elapsed = LIDAR_Lite_v3_Clock::now() - start;
+	m_metrics.lastNs = elapsed;
+	m_metrics.totalNs += elapsed;
+	if (elapsed < m_metrics.minNs)
+		m_metrics.minNs = elapsed;
+	if (elapsed > m_metrics.maxNs)
+		m_metrics.maxNs = elapsed;
+	if (ok)
+		m_metrics.recoveries++;
+	else
+		m_metrics.failures++;
+	return ok;
+}
+
+void LIDAR_Lite_v3_Recovery::resetMetrics()
+{
+	m_metrics.faults = 0;
+	m_metrics.busErrors = 0;
+	m_metrics.recoveries = 0;
+	m_metrics.failures = 0;
+	m_metrics.restoredWrites = 0;
+	m_metrics.lastNs = 0;
+	m_metrics.minNs = ~(uint64_t)0;
+	m_metrics.maxNs = 0;
+	m_metrics.totalNs = 0;
+}
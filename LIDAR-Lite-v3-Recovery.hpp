@@ -0,0 +1,94 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Recovery.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_RECOVERY_HPP
+#define LIDAR_LITE_V3_RECOVERY_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+
+/*
+ * Fault detection and recovery for LIDAR_Lite_v3_Base.
+ *
+ * Detection works on the STATUS byte the caller already read while polling BusyFlag,
+ * so the healthy path costs no extra bus transactions. On a fault the device is reset,
+ * only configuration registers that differ from their dflt value are rewritten and only
+ * those are read back to validate, in as few bursts as LIDAR_Lite_v3_Snapshot groups them.
+ * A POWER_CONTROL value with the Sleep bit set is written last, after validation, and never
+ * read back: any bus access wakes the device and reinitializes it.
+ */
+class LIDAR_Lite_v3_Recovery
+{
+public:
+	/* Recovery counters and latency (nanoseconds) */
+	struct Metrics
+	{
+		uint32_t faults;         // STATUS faults seen by check()
+		uint32_t busErrors;      // Bus errors reported by busError()
+		uint32_t recoveries;     // Successful recoveries
+		uint32_t failures;       // Recoveries that timed out in reset or failed validation
+		uint32_t restoredWrites; // Register writes issued while restoring
+		uint64_t lastNs;
+		uint64_t minNs;
+		uint64_t maxNs;
+		uint64_t totalNs;
+	};
+
+	/* Number of STATUS polls to wait for the device to come out of reset */
+	static const uint16_t RESET_POLL_LIMIT = 1000;
+
+	LIDAR_Lite_v3_Recovery(LIDAR_Lite_v3_Base &device);
+
+	/* Write a configuration register and remember its value for restoring. Returns false for registers that are not restorable. */
+	bool set(uint16_t address, uint8_t value);
+
+	/* True if the STATUS byte reports HealthFlag ERR or ProcessErrorFlag ERR */
+	static bool isFault(uint8_t status)
+	{
+		typedef LIDAR_Lite_v3_Base::STATUS S;
+		return (status & S::HealthFlag::mask) == 0 || (status & S::ProcessErrorFlag::mask) != 0;
+	}
+
+	/* Hot path: inspect an already read STATUS byte, recover on fault. Returns true if the device is healthy. */
+	bool check(uint8_t status)
+	{
+		if (!isFault(status))
+			return true;
+		m_metrics.faults++;
+		return recover();
+	}
+
+	/* Report a failed bus transaction from the transport layer, triggers recovery. */
+	bool busError();
+
+	/* Reset, restore non-default registers and validate. Returns false if the device stays busy after the reset or validation fails. */
+	bool recover();
+
+	const Metrics &metrics() const { return m_metrics; }
+	void resetMetrics();
+
+private:
+	struct Entry
+	{
+		uint16_t address;
+		uint8_t dflt;
+		uint8_t value;
+	};
+
+	/* Configuration registers of the register map, less I2C_CONFIG */
+	static const uint8_t CONFIG_COUNT = 7;
+
+	LIDAR_Lite_v3_Base &m_device;
+	Entry m_config[CONFIG_COUNT];
+	uint8_t m_count;
+	Metrics m_metrics;
+};
+
+#endif /* LIDAR_LITE_V3_RECOVERY_HPP */
@@ -0,0 +1,150 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Scan.cpp
+ */
+
+#include "LIDAR-Lite-v3-Scan.hpp"
+
+#include <cmath>
+
+static const double TWO_PI = 6.283185307179586;
+
+LIDAR_Lite_v3_ScanAssembler::LIDAR_Lite_v3_ScanAssembler(uint32_t ticksPerRevolution, uint32_t maxPoints, uint8_t poolSize)
+	: m_ticksPerRevolution(ticksPerRevolution ? ticksPerRevolution : 1), m_maxPoints(maxPoints),
+	  m_poolSize(poolSize < MAX_POOL ? poolSize : MAX_POOL), m_current(-1), m_revolution(0),
+	  m_lastRaw(0)
+{
+	size_t total = (size_t)m_poolSize * maxPoints;
+	m_angle = new float[total];
+	m_distance = new uint16_t[total];
+	m_signalStrength = new uint8_t[total];
+	m_status = new uint8_t[total];
+	m_time = new uint64_t[total];
+	for (uint8_t i = 0; i < m_poolSize; i++)
+	{
+		size_t offset = (size_t)i * maxPoints;
+		m_scans[i].revolution = 0;
+		m_scans[i].count = 0;
+		m_scans[i].angle = m_angle + offset;
+		m_scans[i].distance = m_distance + offset;
+		m_scans[i].signalStrength = m_signalStrength + offset;
+		m_scans[i].status = m_status + offset;
+		m_scans[i].time = m_time + offset;
+		m_free.push(i);
+	}
+	m_stats.points = 0;
+	m_stats.droppedPoints = 0;
+	m_stats.droppedScans = 0;
+	m_stats.scans = 0;
+}
+
+LIDAR_Lite_v3_ScanAssembler::~LIDAR_Lite_v3_ScanAssembler()
+{
+	delete[] m_angle;
+	delete[] m_distance;
+	delete[] m_signalStrength;
+	delete[] m_status;
+	delete[] m_time;
+}
+
+void LIDAR_Lite_v3_ScanAssembler::addTick(uint64_t time, uint32_t tick)
+{
+	/* Unwrap the counter through the signed difference to the previous value */
+	Tick t;
+	t.time = time;
+	t.pos = m_ticks.empty() ? tick : m_ticks.back().pos + (int32_t)(tick - m_lastRaw);
+	m_ticks.push(t);
+	m_lastRaw = tick;
+
+	LIDAR_Lite_v3_TimedMeasurement sample;
+	while (m_ticks.size() >= 2 && !m_pending.empty() && m_pending.front().time.midpoint <= time)
+	{
+		m_pending.pop(sample);
+		place(sample);
+	}
+}
+
+void LIDAR_Lite_v3_ScanAssembler::addSample(const LIDAR_Lite_v3_TimedMeasurement &sample)
+{
+	if (m_ticks.size() >= 2 && sample.time.midpoint <= m_ticks.back().time)
+		place(sample);
+	else if (!m_pending.push(sample))
+		m_stats.droppedPoints++;
+}
+
+void LIDAR_Lite_v3_ScanAssembler::place(const LIDAR_Lite_v3_TimedMeasurement &sample)
+{
+	uint64_t time = sample.time.midpoint;
+	if (time < m_ticks[0].time)
+	{
+		m_stats.droppedPoints++;
+		return;
+	}
+
+	/* Linear interpolation between the ticks before and after the midpoint */
+	size_t k = m_ticks.size() - 1;
+	while (k > 1 && m_ticks[k - 1].time > time)
+		k--;
+	const Tick &a = m_ticks[k - 1], &b = m_ticks[k];
+	double pos = (double)b.pos;
+	if (b.time != a.time)
+		pos = a.pos + (double)(b.pos - a.pos) * (double)(time - a.time) / (double)(b.time - a.time);
+	double turns = pos / m_ticksPerRevolution;
+	double revolution = std::floor(turns);
+
+	bool changed = (int64_t)revolution != m_revolution;
+	if (changed && m_current >= 0)
+	{
+		m_ready.push((uint8_t)m_current);
+		m_stats.scans++;
+		m_current = -1;
+	}
+	if (changed || m_current < 0)
+	{
+		uint8_t index;
+		if (m_free.pop(index))
+		{
+			m_current = index;
+			m_scans[index].revolution = (int64_t)revolution;
+			m_scans[index].count = 0;
+		}
+		else if (changed)
+			m_stats.droppedScans++;
+		m_revolution = (int64_t)revolution;
+	}
+
+	if (m_current < 0 || m_scans[m_current].count >= m_maxPoints)
+	{
+		m_stats.droppedPoints++;
+		return;
+	}
+
+	LIDAR_Lite_v3_Scan &scan = m_scans[m_current];
+	uint32_t i = scan.count++;
+	scan.angle[i] = (float)((turns - revolution) * TWO_PI);
+	scan.distance[i] = sample.measurement.distance;
+	scan.signalStrength[i] = sample.measurement.signalStrength;
+	scan.status[i] = sample.measurement.status;
+	scan.time[i] = sample.time.midpoint;
+	m_stats.points++;
+}
+
+LIDAR_Lite_v3_Scan *LIDAR_Lite_v3_ScanAssembler::next()
+{
+	uint8_t index;
+	if (!m_ready.pop(index))
+		return 0;
+	return &m_scans[index];
+}
+
+void LIDAR_Lite_v3_ScanAssembler::release(LIDAR_Lite_v3_Scan *scan)
+{
+	if (scan)
+		m_free.push((uint8_t)(scan - m_scans));
+}
@@ -0,0 +1,102 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Scan.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_SCAN_HPP
+#define LIDAR_LITE_V3_SCAN_HPP
+
+#include "LIDAR-Lite-v3-Batch.hpp"
+#include "LIDAR-Lite-v3-Timestamp.hpp"
+
+/* One revolution as structure of arrays, the arrays point into the assembler's pool */
+struct LIDAR_Lite_v3_Scan
+{
+	int64_t revolution;      // negative while the encoder position is below its start
+	uint32_t count;
+	float *angle;            // radians, 0..2pi
+	uint16_t *distance;      // centimeters
+	uint8_t *signalStrength;
+	uint8_t *status;
+	uint64_t *time;          // acquisition midpoint, nanoseconds
+};
+
+/*
+ * Scanning-mount scan assembly. Distance samples are joined with encoder ticks by interpolating
+ * the encoder position at each sample's acquisition midpoint between the two ticks around it,
+ * from the last TICKS ticks. Samples newer than the last tick wait in a fixed queue for the next
+ * tick, samples older than the oldest kept tick are dropped. Completed revolutions are handed out from a pool
+ * allocated once in the constructor, nothing is allocated per point. A revolution that starts
+ * while no buffer is free is filled from the point a buffer is released.
+ */
+class LIDAR_Lite_v3_ScanAssembler
+{
+public:
+	static const uint8_t MAX_POOL = 16;
+	static const size_t PENDING = 64;
+	/* Encoder ticks kept for interpolating late samples */
+	static const size_t TICKS = 16;
+
+	struct Stats
+	{
+		uint64_t points;
+		uint64_t droppedPoints; // scan full, sample older than the kept ticks or pending queue full
+		uint32_t droppedScans;  // no free scan buffer
+		uint32_t scans;
+	};
+
+	LIDAR_Lite_v3_ScanAssembler(uint32_t ticksPerRevolution, uint32_t maxPoints, uint8_t poolSize=4);
+	~LIDAR_Lite_v3_ScanAssembler();
+
+	/* Encoder tick counter value observed at time (nanoseconds), the counter may wrap */
+	void addTick(uint64_t time, uint32_t tick);
+	/* Distance sample, placed at its acquisition midpoint */
+	void addSample(const LIDAR_Lite_v3_TimedMeasurement &sample);
+
+	/* Oldest completed revolution or 0, hand it back with release() */
+	LIDAR_Lite_v3_Scan *next();
+	void release(LIDAR_Lite_v3_Scan *scan);
+
+	const Stats &stats() const { return m_stats; }
+
+private:
+	LIDAR_Lite_v3_ScanAssembler(const LIDAR_Lite_v3_ScanAssembler &);
+	LIDAR_Lite_v3_ScanAssembler &operator=(const LIDAR_Lite_v3_ScanAssembler &);
+
+	void place(const LIDAR_Lite_v3_TimedMeasurement &sample);
+
+	uint32_t m_ticksPerRevolution;
+	uint32_t m_maxPoints;
+	uint8_t m_poolSize;
+
+	float *m_angle;
+	uint16_t *m_distance;
+	uint8_t *m_signalStrength;
+	uint8_t *m_status;
+	uint64_t *m_time;
+	LIDAR_Lite_v3_Scan m_scans[MAX_POOL];
+	LIDAR_Lite_v3_Queue<uint8_t, MAX_POOL> m_free;
+	LIDAR_Lite_v3_Queue<uint8_t, MAX_POOL> m_ready;
+	int m_current; // scan being filled, -1 if none
+	int64_t m_revolution;
+
+	struct Tick
+	{
+		uint64_t time;
+		int64_t pos; // unwrapped to 64 bit
+	};
+
+	LIDAR_Lite_v3_Ring<Tick, TICKS> m_ticks;
+	uint32_t m_lastRaw;
+
+	LIDAR_Lite_v3_Queue<LIDAR_Lite_v3_TimedMeasurement, PENDING> m_pending;
+	Stats m_stats;
+};
+
+#endif /* LIDAR_LITE_V3_SCAN_HPP */
@@ -0,0 +1,196 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Scheduler.cpp
+ */
+
+#include "LIDAR-Lite-v3-Scheduler.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+static uint8_t popcount(uint32_t v)
+{
+	uint8_t n = 0;
+	for (; v; v &= v - 1)
+		n++;
+	return n;
+}
+
+LIDAR_Lite_v3_Scheduler::LIDAR_Lite_v3_Scheduler(LIDAR_Lite_v3_Base **sensors, uint8_t count, uint8_t biasInterval)
+	: m_sensors(sensors), m_count(count <= MAX_SENSORS ? count : 0), m_trigger(biasInterval), m_busy(0)
+{
+	for (uint8_t i = 0; i < MAX_SENSORS; i++)
+		m_graph[i] = 0;
+	plan();
+}
+
+void LIDAR_Lite_v3_Scheduler::interferes(uint8_t a, uint8_t b)
+{
+	if (a >= m_count || b >= m_count || a == b)
+		return;
+	m_graph[a] |= 1u << b;
+	m_graph[b] |= 1u << a;
+}
+
+uint8_t LIDAR_Lite_v3_Scheduler::plan()
+{
+	/* Welsh-Powell: visit sensors by decreasing degree, put each into the first slot without a conflict */
+	uint8_t order[MAX_SENSORS];
+	for (uint8_t i = 0; i < m_count; i++)
+		order[i] = i;
+	for (uint8_t i = 1; i < m_count; i++)
+		for (uint8_t j = i; j > 0 && popcount(m_graph[order[j]]) > popcount(m_graph[order[j - 1]]); j--)
+		{
+			uint8_t t = order[j];
+			order[j] = order[j - 1];
+			order[j - 1] = t;
+		}
+
+	m_slotCount = 0;
+	for (uint8_t i = 0; i < m_count; i++)
+	{
+		uint8_t sensor = order[i];
+		uint8_t s = 0;
+		while (s < m_slotCount && (m_slots[s] & m_graph[sensor]))
+			s++;
+		if (s == m_slotCount)
+			m_slots[m_slotCount++] = 0;
+		m_slots[s] |= 1u << sensor;
+	}
+	m_busy = 0;
+	clearReport();
+	return m_slotCount;
+}
+
+uint32_t LIDAR_Lite_v3_Scheduler::blocked() const
+{
+	uint32_t blocked = 0;
+	for (uint8_t i = 0; i < m_count; i++)
+		if (m_busy & (1u << i))
+			blocked |= m_graph[i];
+	return blocked;
+}
+
+uint32_t LIDAR_Lite_v3_Scheduler::settle(uint8_t slot)
+{
+	/* A sensor that timed out may still be acquiring, wait for it to go idle before triggering sensors it interferes with */
+	for (uint16_t poll = 0; poll < BUSY_POLL_LIMIT && (blocked() & m_slots[slot]); poll++)
+	{
+		for (uint8_t i = 0; i < m_count; i++)
+		{
+			uint32_t bit = 1u << i;
+			if ((m_busy & bit) && (m_graph[i] & m_slots[slot])
+				&& (m_sensors[i]->getSTATUS() & B::STATUS::BusyFlag::mask) == 0)
+				m_busy &= ~bit;
+		}
+	}
+	return m_slots[slot] & ~blocked();
+}
+
+void LIDAR_Lite_v3_Scheduler::trigger(uint8_t slot, uint32_t sensors, uint8_t command)
+{
+	for (uint8_t i = 0; i < m_count; i++)
+		if (sensors & (1u << i))
+			m_sensors[i]->setACQ_COMMAND(command);
+	m_triggered[slot] = LIDAR_Lite_v3_Clock::now();
+}
+
+bool LIDAR_Lite_v3_Scheduler::wait(uint8_t slot, uint32_t sensors, uint32_t &ready, uint8_t *status)
+{
+	ready = 0;
+	for (uint16_t poll = 0; poll < BUSY_POLL_LIMIT && ready != sensors; poll++)
+	{
+		for (uint8_t i = 0; i < m_count; i++)
+		{
+			uint32_t bit = 1u << i;
+			if (!(sensors & bit) || (ready & bit))
+				continue;
+			status[i] = m_sensors[i]->getSTATUS();
+			if ((status[i] & B::STATUS::BusyFlag::mask) == 0)
+				ready |= bit;
+		}
+	}
+	m_acquireNs[slot] += LIDAR_Lite_v3_Clock::now() - m_triggered[slot];
+	m_busy = (m_busy & ~ready) | (sensors & ~ready);
+	return ready == sensors;
+}
+
+uint8_t LIDAR_Lite_v3_Scheduler::cycle(LIDAR_Lite_v3_Measurement *out)
+{
+	uint64_t start = LIDAR_Lite_v3_Clock::now();
+	uint8_t status[MAX_SENSORS];
+	uint8_t delivered = 0;
+
+	/* All sensors run bias correction in the same cycle */
+	uint8_t command = m_trigger.next();
+	uint32_t fired = 0;
+	if (m_slotCount)
+	{
+		fired = settle(0);
+		trigger(0, fired, command);
+	}
+	for (uint8_t s = 0; s < m_slotCount; s++)
+	{
+		uint32_t ready;
+		wait(s, fired, ready, status);
+
+		/* Start the next slot before reading this one so the readout overlaps its acquisition */
+		if (s + 1 < m_slotCount)
+		{
+			fired = settle(s + 1);
+			trigger(s + 1, fired, command);
+		}
+
+		for (uint8_t i = 0; i < m_count; i++)
+		{
+			uint32_t bit = 1u << i;
+			if (!(m_slots[s] & bit))
+				continue;
+			if (!(ready & bit))
+			{
+				out[i].status = B::STATUS::BusyFlag::mask;
+				continue;
+			}
+			out[i].status = status[i];
+			out[i].signalStrength = m_sensors[i]->getSIGNAL_STRENGTH();
+			out[i].distance = m_sensors[i]->getFULL_DELAY();
+			delivered++;
+		}
+	}
+
+	m_cycles++;
+	m_samples += delivered;
+	m_elapsedNs += LIDAR_Lite_v3_Clock::now() - start;
+	return delivered;
+}
+
+LIDAR_Lite_v3_Scheduler::Report LIDAR_Lite_v3_Scheduler::report() const
+{
+	Report r;
+	r.cycles = m_cycles;
+	r.samples = m_samples;
+	r.elapsedNs = m_elapsedNs;
+	r.slots = m_slotCount;
+	r.achievedHz = m_elapsedNs ? m_samples * 1e9 / m_elapsedNs : 0.0;
+
+	double acquire = 0;
+	for (uint8_t s = 0; s < m_slotCount; s++)
+		acquire += m_cycles ? (double)m_acquireNs[s] / m_cycles : 0.0;
+	r.boundHz = acquire > 0 ? m_count * 1e9 / acquire : 0.0;
+	return r;
+}
+
+void LIDAR_Lite_v3_Scheduler::clearReport()
+{
+	m_cycles = 0;
+	m_samples = 0;
+	m_elapsedNs = 0;
+	for (uint8_t s = 0; s < MAX_SENSORS; s++)
+		m_acquireNs[s] = 0;
+}
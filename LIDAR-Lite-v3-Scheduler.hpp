@@ -0,0 +1,91 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Scheduler.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_SCHEDULER_HPP
+#define LIDAR_LITE_V3_SCHEDULER_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+
+/*
+ * Time-division trigger scheduler for co-located sensors.
+ *
+ * Sensors that interfere never acquire at the same time: plan() colors the interference graph
+ * (largest degree first) and every color becomes a slot whose sensors are triggered together.
+ * cycle() pipelines the slots: as soon as a slot is ready the next one is triggered, and the
+ * finished slot is read out while the next one acquires.
+ */
+class LIDAR_Lite_v3_Scheduler
+{
+public:
+	static const uint8_t MAX_SENSORS = 32;
+	/* Number of STATUS polls per sensor before a slot is abandoned */
+	static const uint16_t BUSY_POLL_LIMIT = LIDAR_Lite_v3_Trigger::BUSY_POLL_LIMIT;
+
+	struct Report
+	{
+		uint64_t cycles;
+		uint64_t samples;   // valid measurements read
+		uint64_t elapsedNs; // time spent in cycle()
+		uint8_t slots;
+		double achievedHz;  // aggregate samples per second
+		double boundHz;     // sensors / sum of mean slot acquisition times, readout fully hidden
+	};
+
+	/* More than MAX_SENSORS sensors are rejected: count() is 0 and nothing is scheduled */
+	LIDAR_Lite_v3_Scheduler(LIDAR_Lite_v3_Base **sensors, uint8_t count, uint8_t biasInterval=100);
+
+	uint8_t count() const { return m_count; }
+
+	/* Mark sensors a and b as interfering */
+	void interferes(uint8_t a, uint8_t b);
+
+	/* Build the slot plan from the interference graph and clear the report, returns the number of slots */
+	uint8_t plan();
+
+	uint8_t slots() const { return m_slotCount; }
+	/* Bit mask of the sensors triggered in a slot */
+	uint32_t slot(uint8_t i) const { return m_slots[i]; }
+
+	/*
+	 * Run every slot once. out[i] receives sensor i, sensors that stayed busy get only BusyFlag set in status.
+	 * A sensor still busy after its slot timed out holds back the sensors it interferes with: they are
+	 * triggered once it is idle, or skipped (BusyFlag) if it stays busy for another BUSY_POLL_LIMIT polls.
+	 * Returns the number of sensors that delivered a measurement.
+	 */
+	uint8_t cycle(LIDAR_Lite_v3_Measurement *out);
+
+	Report report() const;
+	void clearReport();
+
+private:
+	uint32_t blocked() const;
+	uint32_t settle(uint8_t slot);
+	void trigger(uint8_t slot, uint32_t sensors, uint8_t command);
+	bool wait(uint8_t slot, uint32_t sensors, uint32_t &ready, uint8_t *status);
+
+	LIDAR_Lite_v3_Base **m_sensors;
+	uint8_t m_count;
+	LIDAR_Lite_v3_Trigger m_trigger;
+	uint32_t m_graph[MAX_SENSORS];
+	uint32_t m_slots[MAX_SENSORS];
+	uint8_t m_slotCount;
+	uint32_t m_busy; // sensors that timed out and were not seen idle since
+
+	uint64_t m_triggered[MAX_SENSORS]; // slot trigger time
+	uint64_t m_acquireNs[MAX_SENSORS]; // accumulated slot acquisition time
+	uint64_t m_cycles;
+	uint64_t m_samples;
+	uint64_t m_elapsedNs;
+};
+
+#endif /* LIDAR_LITE_V3_SCHEDULER_HPP */
@@ -0,0 +1,241 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-SharedMemory.cpp
+ */
+
+#include "LIDAR-Lite-v3-SharedMemory.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef LIDAR_Lite_v3_ShmLayout L;
+
+LIDAR_Lite_v3_ShmPublisher::LIDAR_Lite_v3_ShmPublisher(LIDAR_Lite_v3_Base &device)
+	: m_timestamper(device), m_header(0), m_slots(0), m_size(0)
+{
+	m_name[0] = 0;
+}
+
+LIDAR_Lite_v3_ShmPublisher::~LIDAR_Lite_v3_ShmPublisher()
+{
+	close();
+}
+
+bool LIDAR_Lite_v3_ShmPublisher::create(const char *name, uint32_t capacity)
+{
+	close();
+	if (capacity == 0 || strlen(name) >= sizeof(m_name))
+		return false;
+	shm_unlink(name);
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+	if (fd < 0)
+		return false;
+	size_t size = L::size(capacity);
+	if (ftruncate(fd, size) != 0)
+	{
+		::close(fd);
+		shm_unlink(name);
+		return false;
+	}
+	void *base = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (base == MAP_FAILED)
+	{
+		shm_unlink(name);
+		return false;
+	}
+
+	strcpy(m_name, name);
+	m_size = size;
+	m_header = (L::Header *)base;
+	m_slots = (L::Slot *)(m_header + 1);
+	m_header->version = L::VERSION;
+	m_header->capacity = capacity;
+	m_header->slotSize = sizeof(L::Slot);
+	m_header->head = 0;
+	m_header->closed = 0;
+	/* Magic last, subscribers attaching early see an incomplete header as invalid */
+	__atomic_store_n(&m_header->magic, L::MAGIC, __ATOMIC_RELEASE);
+	return true;
+}
+
+void LIDAR_Lite_v3_ShmPublisher::close()
+{
+	if (!m_header)
+		return;
+	__atomic_store_n(&m_header->closed, 1, __ATOMIC_RELEASE);
+	munmap(m_header, m_size);
+	shm_unlink(m_name);
+	m_header = 0;
+	m_slots = 0;
+	m_size = 0;
+	m_name[0] = 0;
+}
+
+bool LIDAR_Lite_v3_ShmPublisher::step()
+{
+	LIDAR_Lite_v3_Sample sample;
+	if (!m_timestamper.measure(sample.data))
+		return false;
+	publish(sample);
+	return true;
+}
+
+void LIDAR_Lite_v3_ShmPublisher::publish(LIDAR_Lite_v3_Sample &sample)
+{
+	if (!m_header)
+		return;
+	uint64_t n = m_header->head;
+	L::Slot &slot = m_slots[n % m_header->capacity];
+	sample.sequence = n + 1;
+
+	__atomic_store_n(&slot.seq, 2 * n + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	L::Words::store(slot.words, sample);
+	__atomic_store_n(&slot.seq, 2 * n + 2, __ATOMIC_RELEASE);
+	__atomic_store_n(&m_header->head, n + 1, __ATOMIC_RELEASE);
+}
+
+LIDAR_Lite_v3_ShmSubscriber::LIDAR_Lite_v3_ShmSubscriber()
+	: m_header(0), m_slots(0), m_size(0), m_device(0), m_inode(0), m_next(0), m_overruns(0)
+{
+	m_name[0] = 0;
+}
+
+LIDAR_Lite_v3_ShmSubscriber::~LIDAR_Lite_v3_ShmSubscriber()
+{
+	detach();
+}
+
+bool LIDAR_Lite_v3_ShmSubscriber::attach(const char *name)
+{
+	detach();
+	if (strlen(name) >= sizeof(m_name))
+		return false;
+	int fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(L::Header))
+	{
+		::close(fd);
+		return false;
+	}
+	void *base = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (base == MAP_FAILED)
+		return false;
+
+	const L::Header *header = (const L::Header *)base;
+	if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != L::MAGIC || header->version != L::VERSION
+		|| header->slotSize != sizeof(L::Slot) || header->capacity == 0 || L::size(header->capacity) > (size_t)st.st_size)
+	{
+		munmap(base, st.st_size);
+		return false;
+	}
+
+	m_header = header;
+	m_slots = (const L::Slot *)(header + 1);
+	m_size = st.st_size;
+	strcpy(m_name, name);
+	m_device = st.st_dev;
+	m_inode = st.st_ino;
+	m_next = __atomic_load_n(&header->head, __ATOMIC_ACQUIRE);
+	m_overruns = 0;
+	return true;
+}
+
+void LIDAR_Lite_v3_ShmSubscriber::detach()
+{
+	if (m_header)
+		munmap((void *)m_header, m_size);
+	m_header = 0;
+	m_slots = 0;
+	m_size = 0;
+	m_name[0] = 0;
+}
+
+bool LIDAR_Lite_v3_ShmSubscriber::stale() const
+{
+	if (!m_header)
+		return false;
+	if (__atomic_load_n(&m_header->closed, __ATOMIC_ACQUIRE))
+		return true;
+	/* A publisher that died without close() leaves the flag clear, compare the file instead */
+	int fd = shm_open(m_name, O_RDONLY, 0);
+	if (fd < 0)
+		return true;
+	struct stat st;
+	bool same = fstat(fd, &st) == 0 && (uint64_t)st.st_dev == m_device && (uint64_t)st.st_ino == m_inode;
+	::close(fd);
+	return !same;
+}
+
+const L::Slot *LIDAR_Lite_v3_ShmSubscriber::next()
+{
+	if (!m_header)
+		return 0;
+	uint32_t capacity = m_header->capacity;
+	for (;;)
+	{
+		uint64_t head = __atomic_load_n(&m_header->head, __ATOMIC_ACQUIRE);
+		if (m_next >= head)
+			return 0;
+		if (head - m_next > capacity)
+		{
+			m_overruns += head - capacity - m_next;
+			m_next = head - capacity;
+		}
+		const L::Slot &slot = m_slots[m_next % capacity];
+		if (__atomic_load_n(&slot.seq, __ATOMIC_ACQUIRE) == 2 * m_next + 2)
+			return &slot;
+		/* Already being overwritten by a newer sample */
+		m_overruns++;
+		m_next++;
+	}
+}
+
+const LIDAR_Lite_v3_Sample *LIDAR_Lite_v3_ShmSubscriber::peek()
+{
+	const L::Slot *slot = next();
+	return slot ? &slot->sample : 0;
+}
+
+bool LIDAR_Lite_v3_ShmSubscriber::release()
+{
+	/* Nothing was peeked: leave m_next where it is, stepping past head would skip the next sample */
+	if (!m_header || m_next >= __atomic_load_n(&m_header->head, __ATOMIC_ACQUIRE))
+		return false;
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	const L::Slot &slot = m_slots[m_next % m_header->capacity];
+	bool ok = __atomic_load_n(&slot.seq, __ATOMIC_RELAXED) == 2 * m_next + 2;
+	if (!ok)
+		m_overruns++;
+	m_next++;
+	return ok;
+}
+
+bool LIDAR_Lite_v3_ShmSubscriber::read(LIDAR_Lite_v3_Sample &sample)
+{
+	for (;;)
+	{
+		const L::Slot *slot = next();
+		if (!slot)
+			return false;
+		LIDAR_Lite_v3_Sample copy;
+		L::Words::load(copy, slot->words);
+		if (release())
+		{
+			sample = copy;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,134 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-SharedMemory.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_SHAREDMEMORY_HPP
+#define LIDAR_LITE_V3_SHAREDMEMORY_HPP
+
+#include <cstddef>
+#include "LIDAR-Lite-v3-Publisher.hpp"
+
+/*
+ * Cross-process sample bus in a POSIX shared memory segment.
+ *
+ * One publisher process owns the device and writes samples into a ring of slots. Every slot
+ * carries its own sequence word (odd while being written), the header holds the number of
+ * samples published. Samples are copied in and out through relaxed atomic words
+ * (LIDAR_Lite_v3_AtomicWords). Subscribers attach read-only and read in place; a subscriber that
+ * falls more than a ring behind skips ahead and counts the overrun. Link with -lrt on older glibc.
+ */
+struct LIDAR_Lite_v3_ShmLayout
+{
+	static const uint32_t MAGIC = 0x4c4c5633; // "LLV3"
+	static const uint32_t VERSION = 2;
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t capacity;
+		uint32_t slotSize;
+		uint64_t head;   // samples published
+		uint32_t closed; // set by the publisher before it unlinks the segment
+		uint32_t reserved;
+	};
+
+	typedef LIDAR_Lite_v3_AtomicWords<LIDAR_Lite_v3_Sample> Words;
+
+	struct Slot
+	{
+		uint64_t seq; // 2 * index + 1 while writing, 2 * index + 2 when complete
+		union
+		{
+			uint64_t words[Words::WORDS];
+			LIDAR_Lite_v3_Sample sample;
+		};
+	};
+
+	static size_t size(uint32_t capacity) { return sizeof(Header) + (size_t)capacity * sizeof(Slot); }
+};
+
+class LIDAR_Lite_v3_ShmPublisher
+{
+public:
+	LIDAR_Lite_v3_ShmPublisher(LIDAR_Lite_v3_Base &device);
+	~LIDAR_Lite_v3_ShmPublisher();
+
+	/* Create (or replace) the segment, name as for shm_open(), e.g. "/lidar0" */
+	bool create(const char *name, uint32_t capacity);
+	/* Unmap and unlink the segment */
+	void close();
+
+	/* Take one measurement and publish it. Returns false if the device stayed busy. */
+	bool step();
+	/* Publish a sample, its sequence field is assigned here */
+	void publish(LIDAR_Lite_v3_Sample &sample);
+
+	LIDAR_Lite_v3_Timestamper &timestamper() { return m_timestamper; }
+
+private:
+	LIDAR_Lite_v3_ShmPublisher(const LIDAR_Lite_v3_ShmPublisher &);
+	LIDAR_Lite_v3_ShmPublisher &operator=(const LIDAR_Lite_v3_ShmPublisher &);
+
+	LIDAR_Lite_v3_Timestamper m_timestamper;
+	char m_name[64];
+	LIDAR_Lite_v3_ShmLayout::Header *m_header;
+	LIDAR_Lite_v3_ShmLayout::Slot *m_slots;
+	size_t m_size;
+};
+
+class LIDAR_Lite_v3_ShmSubscriber
+{
+public:
+	LIDAR_Lite_v3_ShmSubscriber();
+	~LIDAR_Lite_v3_ShmSubscriber();
+
+	/* Attach read-only, starting at the newest sample */
+	bool attach(const char *name);
+	void detach();
+	/*
+	 * True if the publisher closed the segment or the name now refers to a different segment
+	 * (unlinked and recreated). Costs a shm_open() and fstat(), so call it when peek() comes up
+	 * empty rather than per sample; attach() again to follow the new segment.
+	 */
+	bool stale() const;
+
+	/*
+	 * Zero-copy read of the next sample: returns a pointer into the segment or 0 if nothing new.
+	 * The data is only valid if release() returns true afterwards; reading it in place races with
+	 * the publisher on overrun, use read() where that matters.
+	 */
+	const LIDAR_Lite_v3_Sample *peek();
+	bool release();
+
+	/* Copying read of the next sample through atomic words, returns false if nothing new */
+	bool read(LIDAR_Lite_v3_Sample &sample);
+
+	/* Samples overwritten before this subscriber read them */
+	uint64_t overruns() const { return m_overruns; }
+
+private:
+	LIDAR_Lite_v3_ShmSubscriber(const LIDAR_Lite_v3_ShmSubscriber &);
+	LIDAR_Lite_v3_ShmSubscriber &operator=(const LIDAR_Lite_v3_ShmSubscriber &);
+
+	/* Slot holding the next complete sample, skipping overwritten ones, 0 if nothing new */
+	const LIDAR_Lite_v3_ShmLayout::Slot *next();
+
+	const LIDAR_Lite_v3_ShmLayout::Header *m_header;
+	const LIDAR_Lite_v3_ShmLayout::Slot *m_slots;
+	size_t m_size;
+	char m_name[64];
+	uint64_t m_device; // st_dev and st_ino of the attached segment
+	uint64_t m_inode;
+	uint64_t m_next;
+	uint64_t m_overruns;
+};
+
+#endif /* LIDAR_LITE_V3_SHAREDMEMORY_HPP */
@@ -0,0 +1,328 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Simulator.cpp
+ */
+
+#include "LIDAR-Lite-v3-Simulator.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <time.h>
+
+typedef LIDAR_Lite_v3_Base B;
+typedef LIDAR_Lite_v3_Base::REGISTER_INFO Info;
+
+LIDAR_Lite_v3_SimScript LIDAR_Lite_v3_SimScript::constant(uint16_t distance, uint16_t noise)
+{
+	LIDAR_Lite_v3_SimScript script;
+	memset(&script, 0, sizeof(script));
+	script.noise = noise;
+	script.add(0, distance);
+	return script;
+}
+
+bool LIDAR_Lite_v3_SimScript::add(uint64_t time, uint16_t value)
+{
+	if (count >= MAX_POINTS)
+		return false;
+	timeNs[count] = time;
+	distance[count] = value;
+	count++;
+	return true;
+}
+
+uint16_t LIDAR_Lite_v3_SimScript::at(uint64_t time) const
+{
+	if (count == 0)
+		return 0;
+	if (periodNs)
+		time %= periodNs;
+	if (time <= timeNs[0])
+		return distance[0];
+	for (uint8_t i = 0; i + 1 < count; i++)
+	{
+		if (time < timeNs[i + 1])
+		{
+			int32_t a = distance[i], b = distance[i + 1];
+			uint64_t span = timeNs[i + 1] - timeNs[i];
+			return (uint16_t)(a + (int32_t)((int64_t)(b - a) * (int64_t)(time - timeNs[i]) / (int64_t)span));
+		}
+	}
+	return distance[count - 1];
+}
+
+uint64_t LIDAR_Lite_v3_SimBus::reserve(uint64_t now, uint64_t ns)
+{
+	uint64_t free = __atomic_load_n(&m_free, __ATOMIC_RELAXED), end;
+	do
+		end = (free > now ? free : now) + ns;
+	while (!__atomic_compare_exchange_n(&m_free, &free, end, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	__atomic_fetch_add(&m_busyNs, ns, __ATOMIC_RELAXED);
+	return end;
+}
+
+LIDAR_Lite_v3_SimulatedDevice::LIDAR_Lite_v3_SimulatedDevice(const LIDAR_Lite_v3_SimTiming &timing, const LIDAR_Lite_v3_SimFaults &faults,
+	const LIDAR_Lite_v3_SimScript &script, uint32_t seed, LIDAR_Lite_v3_SimBus *bus)
+	: m_timing(timing), m_faults(faults), m_script(script), m_bus(bus), m_random(seed ? seed : 1), m_latency(0)
+{
+	memset(&m_stats, 0, sizeof(m_stats));
+	/* Spread the fleet over the script so sensors do not move in lockstep */
+	m_phaseNs = script.periodNs ? ((uint64_t)m_random * 2654435761u) % script.periodNs : 0;
+	reset(0);
+	m_unresponsive = 0;
+}
+
+bool LIDAR_Lite_v3_SimulatedDevice::chance(uint32_t ppm)
+{
+	if (ppm == 0)
+		return false;
+	/* xorshift32 */
+	m_random ^= m_random << 13;
+	m_random ^= m_random >> 17;
+	m_random ^= m_random << 5;
+	return m_random % 1000000 < ppm;
+}
+
+void LIDAR_Lite_v3_SimulatedDevice::reset(uint64_t now)
+{
+	memset(m_regs, 0, sizeof(m_regs));
+	for (uint8_t i = 0; i < B::REGISTER_COUNT; i++)
+		if (B::REGISTERS[i].flags & Info::DEFAULT)
+			m_regs[B::REGISTERS[i].address] = B::REGISTERS[i].dflt;
+	m_command = 0;
+	m_repeat = 0;
+	m_completed = 0;
+	m_completion = 0;
+	m_delivered = true;
+	m_asleep = false;
+	m_distance = 0;
+	m_health = B::STATUS::HealthFlag::mask;
+	m_unresponsive = now + m_timing.resetNs;
+}
+
+uint64_t LIDAR_Lite_v3_SimulatedDevice::acquisitionNs() const
+{
+	uint32_t reference = 5;
+	if (m_regs[B::ACQ_CONFIG_REG::__address] & B::ACQ_CONFIG_REG::ReferenceAcquisition::mask)
+		reference = m_regs[B::REF_COUNT_VAL::__address];
+	return m_timing.baseNs + (uint64_t)(m_regs[B::SIG_COUNT_VAL::__address] + reference) * m_timing.perAcquisitionNs;
+}
+
+uint64_t LIDAR_Lite_v3_SimulatedDevice::delayNs() const
+{
+	if (m_regs[B::ACQ_CONFIG_REG::__address] & B::ACQ_CONFIG_REG::Delay::mask)
+		return (uint64_t)m_regs[B::MEASURE_DELAY::__address] * m_timing.delayUnitNs;
+	return m_timing.defaultDelayNs;
+}
+
+bool LIDAR_Lite_v3_SimulatedDevice::transaction(uint16_t bytes, uint64_t now)
+{
+	m_stats.transactions++;
+	uint64_t ns = m_timing.busNs + (uint64_t)bytes * m_timing.byteNs;
+	uint64_t end = ns && m_bus ? m_bus->reserve(now, ns) : now + ns;
+	if (ns && m_timing.spin)
+	{
+		while (LIDAR_Lite_v3_Clock::now() < end)
+			;
+	}
+	else if (ns)
+	{
+		struct timespec ts;
+		ts.tv_sec = end / 1000000000ull;
+		ts.tv_nsec = end % 1000000000ull;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0) == EINTR)
+			;
+	}
+
+	bool ack = true;
+	if (m_asleep)
+	{
+		/* The first transaction wakes the device and is not acknowledged */
+		m_asleep = false;
+		m_unresponsive = now + m_timing.resetNs;
+		ack = false;
+	}
+	else if (now < m_unresponsive || chance(m_faults.nack))
+		ack = false;
+	if (!ack)
+		m_stats.nacks++;
+	return ack;
+}
+
+void LIDAR_Lite_v3_SimulatedDevice::update(uint64_t now)
+{
+	if (m_repeat == 0)
+		return;
+	uint64_t acquisition = acquisitionNs(), cycle = acquisition + delayNs();
+	uint64_t elapsed = now - m_command;
+	uint64_t done = elapsed < acquisition ? 0 : (elapsed - acquisition) / cycle + 1;
+	if (done > m_repeat)
+		done = m_repeat;
+	if (done <= m_completed)
+		return;
+
+	m_stats.results += done - m_completed;
+	m_completed = (uint32_t)done;
+	m_completion = m_command + acquisition + (done - 1) * cycle;
+	m_delivered = false;
+
+	int32_t distance = m_script.at(m_completion + m_phaseNs);
+	bool target = distance != 0;
+	if (target && m_script.noise)
+	{
+		chance(1);
+		distance += (int32_t)(m_random % (2u * m_script.noise + 1)) - m_script.noise;
+		if (distance < 1)
+			distance = 1;
+	}
+	if (!target)
+		distance = 1;
+
+	m_health = B::STATUS::HealthFlag::mask;
+	if (chance(m_faults.health))
+	{
+		m_health = B::STATUS::ProcessErrorFlag::mask;
+		m_stats.healthFaults++;
+	}
+	if (!target)
+		m_health |= B::STATUS::InvalidSignalFlag::mask;
+
+	int32_t velocity = distance - m_distance;
+	velocity = velocity > 127 ? 127 : velocity;
+	velocity = velocity < -128 ? -128 : velocity;
+	int32_t strength = target ? 255 - distance / 16 : 0;
+	strength = strength < 10 && target ? 10 : strength;
+
+	m_regs[B::LAST_DELAY_HIGH::__address] = m_regs[B::FULL_DELAY::__address];
+	m_regs[B::LAST_DELAY_LOW::__address] = m_regs[B::FULL_DELAY::__address + 1];
+	m_regs[B::FULL_DELAY::__address] = (uint8_t)(distance >> 8);
+	m_regs[B::FULL_DELAY::__address + 1] = (uint8_t)distance;
+	m_regs[B::VELOCITY::__address] = (uint8_t)(int8_t)velocity;
+	m_regs[B::SIGNAL_STRENGTH::__address] = (uint8_t)strength;
+	m_regs[B::PEAK_CORR::__address] = (uint8_t)strength;
+	m_regs[B::NOISE_PEAK::__address] = (uint8_t)(8 + m_random % 16);
+	m_distance = (uint16_t)distance;
+}
+
+uint8_t LIDAR_Lite_v3_SimulatedDevice::status(uint64_t now) const
+{
+	uint8_t status = m_health;
+	if (m_completed < m_repeat)
+	{
+		/* Acquisition k runs from k * cycle to k * cycle + acquisition after the command */
+		uint64_t cycle = acquisitionNs() + delayNs();
+		if (now - m_command >= m_completed * cycle)
+			status |= B::STATUS::BusyFlag::mask;
+	}
+	return status;
+}
+
+uint8_t LIDAR_Lite_v3_SimulatedDevice::get(uint16_t address, uint64_t now)
+{
+	if (address == B::STATUS::__address)
+		return status(now);
+	if ((address == B::FULL_DELAY::__address || address == B::FULL_DELAY::__address + 1) && !m_delivered)
+	{
+		m_delivered = true;
+		m_stats.delivered++;
+		if (m_latency)
+			m_latency->add(now - m_completion);
+	}
+	return address < SIZE ? m_regs[address] : 0;
+}
+
+uint8_t LIDAR_Lite_v3_SimulatedDevice::read8(uint16_t address, uint16_t)
+{
+	if (!transaction(1, LIDAR_Lite_v3_Clock::now()))
+		return 0xff;
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	update(now);
+	return get(address, now);
+}
+
+uint16_t LIDAR_Lite_v3_SimulatedDevice::read16(uint16_t address, uint16_t)
+{
+	if (!transaction(2, LIDAR_Lite_v3_Clock::now()))
+		return 0xffff;
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	update(now);
+	uint8_t high = get(address, now);
+	return (uint16_t)(high << 8 | get(address + 1, now));
+}
+
+void LIDAR_Lite_v3_SimulatedDevice::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	if (!transaction(count, LIDAR_Lite_v3_Clock::now()))
+	{
+		memset(data, 0xff, count);
+		return;
+	}
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	update(now);
+	for (uint16_t i = 0; i < count; i++)
+		data[i] = get(address + i, now);
+}
+
+void LIDAR_Lite_v3_SimulatedDevice::write(uint16_t address, uint8_t value, uint16_t)
+{
+	if (!transaction(1, LIDAR_Lite_v3_Clock::now()))
+		return;
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	update(now);
+
+	if (address == B::ACQ_COMMAND::__address)
+	{
+		if (value == B::ACQ_COMMAND::ACQ_COMMAND_::RESET)
+		{
+			reset(now);
+			return;
+		}
+		m_stats.commands++;
+		if (chance(m_faults.sleep))
+		{
+			/* Registers reinitialize, the next transaction wakes the device */
+			reset(now);
+			m_unresponsive = 0;
+			m_asleep = true;
+			m_stats.sleeps++;
+			return;
+		}
+		uint8_t loops = m_regs[B::OUTER_LOOP_COUNT::__address];
+		m_command = now;
+		m_repeat = loops < 2 ? 1 : loops == 0xff ? 0xffffffffu : loops;
+		m_completed = 0;
+		return;
+	}
+	if (address == B::POWER_CONTROL::__address && (value & B::POWER_CONTROL::Sleep::mask))
+	{
+		reset(now);
+		m_unresponsive = 0;
+		m_asleep = true;
+		return;
+	}
+
+	const Info *info = B::findRegister(address);
+	if (info && (info->flags & Info::WRITE) && address < SIZE)
+		m_regs[address] = value;
+}
+
+void LIDAR_Lite_v3_SimulatedDevice::write(uint16_t address, uint16_t value, uint16_t)
+{
+	if (!transaction(2, LIDAR_Lite_v3_Clock::now()))
+		return;
+	uint64_t now = LIDAR_Lite_v3_Clock::now();
+	update(now);
+	const Info *info = B::findRegister(address);
+	if (info && (info->flags & Info::WRITE) && address + 1 < SIZE)
+	{
+		m_regs[address] = (uint8_t)(value >> 8);
+		m_regs[address + 1] = (uint8_t)value;
+	}
+}
@@ -0,0 +1,163 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Simulator.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_SIMULATOR_HPP
+#define LIDAR_LITE_V3_SIMULATOR_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Snapshot.hpp"
+#include "LIDAR-Lite-v3-Histogram.hpp"
+
+/* Timing model of a simulated device, shared by a fleet */
+struct LIDAR_Lite_v3_SimTiming
+{
+	uint32_t baseNs;           // fixed part of an acquisition
+	uint32_t perAcquisitionNs; // per signal (SIG_COUNT_VAL) and reference acquisition
+	uint32_t delayUnitNs;      // MEASURE_DELAY unit in burst mode
+	uint32_t defaultDelayNs;   // burst spacing with ACQ_CONFIG_REG Delay clear
+	uint32_t resetNs;          // unresponsive after a reset or wake from sleep
+	uint32_t busNs;            // per bus transaction
+	uint32_t byteNs;           // per data byte
+	bool spin;                 // busy-wait the bus time (bit-banged bus) instead of sleeping
+
+	/* Roughly a stock device on a 400 kHz bus */
+	static LIDAR_Lite_v3_SimTiming defaults()
+	{
+		LIDAR_Lite_v3_SimTiming t = { 600000, 10000, 500000, 10000000, 22000000, 50000, 22500, false };
+		return t;
+	}
+};
+
+/* Fault rates in parts per million, shared by a fleet */
+struct LIDAR_Lite_v3_SimFaults
+{
+	uint32_t health; // per measurement: HealthFlag cleared, ProcessErrorFlag set
+	uint32_t nack;   // per transaction: write dropped, read returns 0xff
+	uint32_t sleep;  // per command: the device drops into sleep and reinitializes its registers
+};
+
+/*
+ * Target distance over time: piecewise linear through up to MAX_POINTS points, repeating every
+ * periodNs (0: hold the last point). A distance of 0 is no target, reported with InvalidSignalFlag.
+ */
+struct LIDAR_Lite_v3_SimScript
+{
+	static const uint8_t MAX_POINTS = 16;
+
+	uint8_t count;
+	uint64_t periodNs;
+	uint16_t noise; // uniform noise amplitude, centimeters
+	uint64_t timeNs[MAX_POINTS];
+	uint16_t distance[MAX_POINTS];
+
+	static LIDAR_Lite_v3_SimScript constant(uint16_t distance, uint16_t noise=2);
+	/* Append a point, false if full */
+	bool add(uint64_t timeNs, uint16_t distance);
+	uint16_t at(uint64_t timeNs) const;
+};
+
+/*
+ * A bus shared by several simulated devices. Transactions reserve the next free interval of bus
+ * time and the device waits for its end, so transfers on one bus never overlap and no lock is
+ * held while waiting. Uses the GCC/Clang __atomic builtins.
+ */
+class LIDAR_Lite_v3_SimBus
+{
+public:
+	LIDAR_Lite_v3_SimBus() : m_free(0), m_busyNs(0) {}
+
+	/* Reserve ns of bus time starting no earlier than now, returns the time the transfer ends */
+	uint64_t reserve(uint64_t now, uint64_t ns);
+	/* Total bus time reserved */
+	uint64_t busyNs() const { return __atomic_load_n(&m_busyNs, __ATOMIC_RELAXED); }
+
+private:
+	LIDAR_Lite_v3_SimBus(const LIDAR_Lite_v3_SimBus &);
+	LIDAR_Lite_v3_SimBus &operator=(const LIDAR_Lite_v3_SimBus &);
+
+	uint64_t m_free; // end of the last reservation
+	uint64_t m_busyNs;
+};
+
+/*
+ * Simulated device for load and fault testing. Registers start at their defaults and acquisitions
+ * complete after baseNs + (signal + reference acquisitions) * perAcquisitionNs of real time, so the
+ * normal acquisition paths can drive it unchanged. Burst mode follows OUTER_LOOP_COUNT and
+ * MEASURE_DELAY. Every transaction costs the configured bus time on the calling thread, after the
+ * transfers queued ahead of it when the device is attached to a shared LIDAR_Lite_v3_SimBus. The
+ * timing, faults and script are copied.
+ *
+ * With a latency histogram attached, the delay between a result completing and its FULL_DELAY being
+ * read is recorded: how late the host notices results. Use one thread per device.
+ */
+class LIDAR_Lite_v3_SimulatedDevice : public LIDAR_Lite_v3_Base
+{
+public:
+	struct Stats
+	{
+		uint64_t transactions;
+		uint64_t commands;
+		uint64_t results;   // acquisitions completed
+		uint64_t delivered; // results whose FULL_DELAY was read
+		uint64_t nacks;
+		uint64_t sleeps;    // injected sleep resets
+		uint64_t healthFaults;
+	};
+
+	LIDAR_Lite_v3_SimulatedDevice(const LIDAR_Lite_v3_SimTiming &timing, const LIDAR_Lite_v3_SimFaults &faults,
+		const LIDAR_Lite_v3_SimScript &script, uint32_t seed=1, LIDAR_Lite_v3_SimBus *bus=0);
+	virtual ~LIDAR_Lite_v3_SimulatedDevice() {}
+
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	uint16_t read16(uint16_t address, uint16_t n=16);
+	void write(uint16_t address, uint16_t value, uint16_t n=16);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+
+	void latency(LIDAR_Lite_v3_Histogram *histogram) { m_latency = histogram; }
+	Stats stats() const { return m_stats; }
+
+private:
+	static const uint16_t SIZE = LIDAR_Lite_v3_Snapshot::SIZE;
+
+	/* Charge bus time, returns false if the transaction is not acknowledged */
+	bool transaction(uint16_t bytes, uint64_t now);
+	void update(uint64_t now);
+	void reset(uint64_t now);
+	uint8_t status(uint64_t now) const;
+	uint64_t acquisitionNs() const;
+	uint64_t delayNs() const;
+	bool chance(uint32_t ppm);
+	uint8_t get(uint16_t address, uint64_t now);
+
+	LIDAR_Lite_v3_SimTiming m_timing;
+	LIDAR_Lite_v3_SimFaults m_faults;
+	LIDAR_Lite_v3_SimScript m_script;
+	LIDAR_Lite_v3_SimBus *m_bus; // 0: a bus of its own
+	uint32_t m_random;
+	uint64_t m_phaseNs;          // script offset of this device
+
+	uint8_t m_regs[SIZE];
+	uint64_t m_command;          // time of the last measurement command
+	uint32_t m_repeat;           // measurements requested by it
+	uint32_t m_completed;        // of those, materialized into the registers
+	uint64_t m_completion;       // completion time of the latest result
+	bool m_delivered;            // latest result read
+	uint64_t m_unresponsive;     // NACKs until this time
+	bool m_asleep;
+	uint16_t m_distance;         // latest distance, for VELOCITY
+	uint8_t m_health;            // HealthFlag/ProcessErrorFlag of the latest result
+
+	LIDAR_Lite_v3_Histogram *m_latency;
+	Stats m_stats;
+};
+
+#endif /* LIDAR_LITE_V3_SIMULATOR_HPP */
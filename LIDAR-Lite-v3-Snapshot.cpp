@@ -0,0 +1,122 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Snapshot.cpp
+ */
+
+#include "LIDAR-Lite-v3-Snapshot.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+void LIDAR_Lite_v3_Snapshot::clear()
+{
+	for (uint16_t i = 0; i < SIZE; i++)
+	{
+		m_data[i] = 0;
+		m_valid[i] = false;
+	}
+}
+
+void LIDAR_Lite_v3_Snapshot::set(uint16_t address, uint8_t value)
+{
+	if (address < SIZE)
+	{
+		m_data[address] = value;
+		m_valid[address] = true;
+	}
+}
+
+LIDAR_Lite_v3_Snapshot LIDAR_Lite_v3_Snapshot::defaults()
+{
+	LIDAR_Lite_v3_Snapshot snapshot;
+	for (uint8_t i = 0; i < B::REGISTER_COUNT; i++)
+		if (B::REGISTERS[i].flags & Info::DEFAULT)
+			snapshot.set(B::REGISTERS[i].address, B::REGISTERS[i].dflt);
+	return snapshot;
+}
+
+uint8_t LIDAR_Lite_v3_Snapshot::dump(LIDAR_Lite_v3_Base &device, bool all)
+{
+	return dumpRuns(device, all, 0);
+}
+
+uint8_t LIDAR_Lite_v3_Snapshot::dump(LIDAR_Lite_v3_Base &device, const LIDAR_Lite_v3_Snapshot &select)
+{
+	return dumpRuns(device, false, &select);
+}
+
+uint8_t LIDAR_Lite_v3_Snapshot::dumpRuns(LIDAR_Lite_v3_Base &device, bool all, const LIDAR_Lite_v3_Snapshot *select)
+{
+	uint8_t bursts = 0;
+	uint8_t i = 0;
+	while (i < B::REGISTER_COUNT)
+	{
+		const Info &first = B::REGISTERS[i++];
+		if (!selected(first, all, select))
+			continue;
+
+		/* Extend the run while the next selected register is close enough */
+		uint8_t begin = i - 1, end = i;
+		uint16_t last = first.address + first.width / 8 - 1;
+		while (i < B::REGISTER_COUNT)
+		{
+			const Info &next = B::REGISTERS[i];
+			if (next.address > last + MAX_GAP + 1)
+				break;
+			i++;
+			if (selected(next, all, select))
+			{
+				last = next.address + next.width / 8 - 1;
+				end = i;
+			}
+		}
+		i = end;
+
+		device.readBurst(first.address, m_data + first.address, last - first.address + 1);
+		bursts++;
+		for (uint8_t r = begin; r < end; r++)
+		{
+			const Info &info = B::REGISTERS[r];
+			if (selected(info, all, select))
+				for (uint16_t a = info.address; a < info.address + info.width / 8; a++)
+					m_valid[a] = true;
+		}
+	}
+	return bursts;
+}
+
+uint8_t LIDAR_Lite_v3_Snapshot::diff(const LIDAR_Lite_v3_Snapshot &other, uint16_t *addresses, uint8_t max) const
+{
+	uint8_t n = 0;
+	for (uint16_t a = 0; a < SIZE; a++)
+	{
+		if (m_valid[a] && other.m_valid[a] && m_data[a] != other.m_data[a])
+		{
+			if (n < max)
+				addresses[n] = a;
+			n++;
+		}
+	}
+	return n;
+}
+
+uint8_t LIDAR_Lite_v3_Snapshot::restore(LIDAR_Lite_v3_Base &device, const LIDAR_Lite_v3_Snapshot *current) const
+{
+	uint8_t writes = 0;
+	for (uint8_t i = 0; i < B::REGISTER_COUNT; i++)
+	{
+		const Info &info = B::REGISTERS[i];
+		if (!isConfig(info) || !has(info.address))
+			continue;
+		if (current && current->has(info.address) && current->value(info.address) == m_data[info.address])
+			continue;
+		device.write(info.address, m_data[info.address], 8);
+		writes++;
+	}
+	return writes;
+}
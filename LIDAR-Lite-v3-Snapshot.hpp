@@ -0,0 +1,80 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Snapshot.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_SNAPSHOT_HPP
+#define LIDAR_LITE_V3_SNAPSHOT_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+
+/*
+ * Register map snapshot built on LIDAR_Lite_v3_Base::REGISTERS.
+ *
+ * dump() groups the selected registers into runs of nearby addresses and reads each run with one
+ * readBurst(), so a full configuration snapshot takes three transactions instead of one per register.
+ */
+class LIDAR_Lite_v3_Snapshot
+{
+public:
+	typedef LIDAR_Lite_v3_Base::REGISTER_INFO Info;
+
+	/* One past the highest register address */
+	static const uint16_t SIZE = LIDAR_Lite_v3_Base::POWER_CONTROL::__address + 1;
+	/* Largest gap of unselected addresses read through rather than starting a new burst, per transaction overhead dominates on most hosts */
+	static const uint16_t MAX_GAP = 16;
+
+	LIDAR_Lite_v3_Snapshot() { clear(); }
+
+	void clear();
+
+	/* Snapshot holding the reset value of every register with a default */
+	static LIDAR_Lite_v3_Snapshot defaults();
+
+	/* True for readable, non-volatile registers with a reset value: the device configuration */
+	static bool isConfig(const Info &info)
+	{
+		return (info.flags & (Info::READ | Info::WRITE | Info::DEFAULT | Info::VOLATILE)) == (Info::READ | Info::WRITE | Info::DEFAULT);
+	}
+
+	/* Read the configuration registers, or every readable register if all is set. Returns the number of bursts. */
+	uint8_t dump(LIDAR_Lite_v3_Base &device, bool all=false);
+	/* Read the readable registers held by select, grouped the same way. Returns the number of bursts. */
+	uint8_t dump(LIDAR_Lite_v3_Base &device, const LIDAR_Lite_v3_Snapshot &select);
+
+	/* Store addresses of registers held by both snapshots whose values differ, returns the number of differences */
+	uint8_t diff(const LIDAR_Lite_v3_Snapshot &other, uint16_t *addresses, uint8_t max) const;
+
+	/*
+	 * Write the configuration registers held by this snapshot to the device. With current given only
+	 * registers that differ from it are written. Returns the number of writes.
+	 */
+	uint8_t restore(LIDAR_Lite_v3_Base &device, const LIDAR_Lite_v3_Snapshot *current=0) const;
+
+	bool has(uint16_t address) const { return address < SIZE && m_valid[address]; }
+	uint8_t value(uint16_t address) const { return m_data[address]; }
+	void set(uint16_t address, uint8_t value);
+	void erase(uint16_t address) { if (address < SIZE) m_valid[address] = false; }
+
+private:
+	bool selected(const Info &info, bool all, const LIDAR_Lite_v3_Snapshot *select) const
+	{
+		if (!(info.flags & Info::READ))
+			return false;
+		if (select)
+			return select->has(info.address);
+		return all || isConfig(info);
+	}
+	uint8_t dumpRuns(LIDAR_Lite_v3_Base &device, bool all, const LIDAR_Lite_v3_Snapshot *select);
+
+	uint8_t m_data[SIZE];
+	bool m_valid[SIZE];
+};
+
+#endif /* LIDAR_LITE_V3_SNAPSHOT_HPP */
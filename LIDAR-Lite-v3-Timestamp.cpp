@@ -0,0 +1,75 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Timestamp.cpp
+ */
+
+#include "LIDAR-Lite-v3-Timestamp.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+LIDAR_Lite_v3_Timestamper::LIDAR_Lite_v3_Timestamper(LIDAR_Lite_v3_Base &device, uint8_t biasInterval)
+	: m_device(device), m_trigger(biasInterval)
+{
+	configure(B::SIG_COUNT_VAL::SIG_COUNT_VAL_::dflt, B::REF_COUNT_VAL::Value::dflt);
+}
+
+void LIDAR_Lite_v3_Timestamper::configure(uint8_t sigCount, uint8_t refCount)
+{
+	uint32_t total = (uint32_t)sigCount + refCount;
+	m_fractionQ16 = total ? (uint32_t)((((uint64_t)refCount << 1) + sigCount) << 15) / total : 1u << 15;
+}
+
+void LIDAR_Lite_v3_Timestamper::configure()
+{
+	uint8_t sigCount = m_device.getSIG_COUNT_VAL();
+	uint8_t refCount = B::REF_COUNT_VAL::Value::dflt;
+	if (m_device.getACQ_CONFIG_REG() & B::ACQ_CONFIG_REG::ReferenceAcquisition::mask)
+		refCount = m_device.getREF_COUNT_VAL();
+	configure(sigCount, refCount);
+}
+
+bool LIDAR_Lite_v3_Timestamper::measure(LIDAR_Lite_v3_TimedMeasurement &out)
+{
+	m_trigger.fire(m_device);
+	uint64_t issued = LIDAR_Lite_v3_Clock::raw();
+
+	/* The transition happened between the start of the last busy poll and the end of the first ready poll */
+	uint64_t busySeen = issued;
+	for (uint16_t i = 0; i < BUSY_POLL_LIMIT; i++)
+	{
+		uint64_t before = LIDAR_Lite_v3_Clock::raw();
+		uint8_t status = m_device.getSTATUS();
+		uint64_t after = LIDAR_Lite_v3_Clock::raw();
+		if ((status & B::STATUS::BusyFlag::mask) == 0)
+		{
+			uint64_t ready = busySeen + (after - busySeen) / 2;
+			out.measurement.status = status;
+			out.measurement.signalStrength = m_device.getSIGNAL_STRENGTH();
+			out.measurement.distance = m_device.getFULL_DELAY();
+			uint64_t readout = LIDAR_Lite_v3_Clock::raw();
+
+			out.time.issued = issued;
+			out.time.ready = ready;
+			out.time.readout = readout;
+			out.time.midpoint = issued + (((ready - issued) * m_fractionQ16) >> 16);
+			m_latency.add(readout - out.time.midpoint);
+			m_busy.add(ready - issued);
+			return true;
+		}
+		busySeen = before;
+	}
+	return false;
+}
+
+void LIDAR_Lite_v3_Timestamper::clearStats()
+{
+	m_latency.clear();
+	m_busy.clear();
+}
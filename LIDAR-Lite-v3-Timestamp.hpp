@@ -0,0 +1,72 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Timestamp.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_TIMESTAMP_HPP
+#define LIDAR_LITE_V3_TIMESTAMP_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Measurement.hpp"
+#include "LIDAR-Lite-v3-Trigger.hpp"
+#include "LIDAR-Lite-v3-Histogram.hpp"
+
+/* CLOCK_MONOTONIC_RAW timestamps (nanoseconds) of one measurement */
+struct LIDAR_Lite_v3_Timestamps
+{
+	uint64_t issued;   // ACQ_COMMAND write completed
+	uint64_t ready;    // BusyFlag READY transition, midway between the last busy and the first ready poll
+	uint64_t readout;  // FULL_DELAY read completed
+	uint64_t midpoint; // Estimated midpoint of the signal acquisitions
+};
+
+struct LIDAR_Lite_v3_TimedMeasurement
+{
+	LIDAR_Lite_v3_Measurement measurement;
+	LIDAR_Lite_v3_Timestamps time;
+};
+
+/*
+ * Acquisition timestamping for sensor fusion, one instance per sensor.
+ *
+ * The device takes the reference acquisitions (REF_COUNT_VAL, 5 unless ACQ_CONFIG_REG bit 2 is set)
+ * before the signal acquisitions (SIG_COUNT_VAL), so the signal midpoint is placed at
+ * (ref + sig / 2) / (ref + sig) of the busy interval. Call configure() after changing either count.
+ * The latency histogram holds readout - midpoint, its standard deviation is the jitter.
+ */
+class LIDAR_Lite_v3_Timestamper
+{
+public:
+	static const uint16_t BUSY_POLL_LIMIT = LIDAR_Lite_v3_Trigger::BUSY_POLL_LIMIT;
+
+	LIDAR_Lite_v3_Timestamper(LIDAR_Lite_v3_Base &device, uint8_t biasInterval=100);
+
+	/* Set the acquisition counts used for the midpoint estimate */
+	void configure(uint8_t sigCount, uint8_t refCount);
+	/* Read the acquisition counts from the device */
+	void configure();
+
+	/* Trigger, wait and read one timestamped measurement. Returns false if the device stayed busy. */
+	bool measure(LIDAR_Lite_v3_TimedMeasurement &out);
+
+	/* readout - midpoint */
+	const LIDAR_Lite_v3_Histogram &latency() const { return m_latency; }
+	/* ready - issued, the observed busy interval */
+	const LIDAR_Lite_v3_Histogram &busy() const { return m_busy; }
+	void clearStats();
+
+private:
+	LIDAR_Lite_v3_Base &m_device;
+	LIDAR_Lite_v3_Trigger m_trigger;
+	uint32_t m_fractionQ16; // midpoint fraction of the busy interval, 16 bit fixed point
+	LIDAR_Lite_v3_Histogram m_latency;
+	LIDAR_Lite_v3_Histogram m_busy;
+};
+
+#endif /* LIDAR_LITE_V3_TIMESTAMP_HPP */
@@ -0,0 +1,22 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Trigger.cpp
+ */
+
+#include "LIDAR-Lite-v3-Trigger.hpp"
+
+typedef LIDAR_Lite_v3_Base B;
+
+bool LIDAR_Lite_v3_Trigger::wait(LIDAR_Lite_v3_Base &device, uint8_t &status, uint16_t limit)
+{
+	status = B::STATUS::BusyFlag::mask;
+	for (uint16_t i = 0; i < limit && (status & B::STATUS::BusyFlag::mask); i++)
+		status = device.getSTATUS();
+	return (status & B::STATUS::BusyFlag::mask) == 0;
+}
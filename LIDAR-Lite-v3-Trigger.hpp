@@ -0,0 +1,59 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Trigger.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_TRIGGER_HPP
+#define LIDAR_LITE_V3_TRIGGER_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+
+/*
+ * Measurement command sequencing shared by the acquisition paths. Every biasInterval-th measurement
+ * is taken with receiver bias correction (BIAS), the others with NO_BIAS, as recommended for
+ * ACQ_COMMAND. A burst command counts as all of the measurements it takes.
+ */
+class LIDAR_Lite_v3_Trigger
+{
+public:
+	/* Number of STATUS polls before a measurement is abandoned */
+	static const uint16_t BUSY_POLL_LIMIT = 1000;
+
+	LIDAR_Lite_v3_Trigger(uint8_t biasInterval=100) : m_biasInterval(biasInterval), m_count(0) {}
+
+	/* ACQ_COMMAND value for the next command taking count measurements, advances the schedule */
+	uint8_t next(uint16_t count=1)
+	{
+		bool bias = m_count == 0;
+		m_count += count;
+		if (m_count >= m_biasInterval)
+			m_count = 0;
+		if (bias)
+			return LIDAR_Lite_v3_Base::ACQ_COMMAND::ACQ_COMMAND_::BIAS;
+		return LIDAR_Lite_v3_Base::ACQ_COMMAND::ACQ_COMMAND_::NO_BIAS;
+	}
+
+	/* Issue the next command */
+	void fire(LIDAR_Lite_v3_Base &device, uint16_t count=1) { device.setACQ_COMMAND(next(count)); }
+
+	/* Start the schedule over, the next command runs bias correction */
+	void reset() { m_count = 0; }
+
+	/*
+	 * Poll STATUS until BusyFlag clears, at most limit times. status receives the last STATUS read,
+	 * returns false if the device is still busy.
+	 */
+	static bool wait(LIDAR_Lite_v3_Base &device, uint8_t &status, uint16_t limit=BUSY_POLL_LIMIT);
+
+private:
+	uint8_t m_biasInterval;
+	uint16_t m_count; // measurements since the last bias correction
+};
+
+#endif /* LIDAR_LITE_V3_TRIGGER_HPP */
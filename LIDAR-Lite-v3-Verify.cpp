@@ -0,0 +1,145 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Verify.cpp
+ */
+
+#include "LIDAR-Lite-v3-Verify.hpp"
+
+#include <cstring>
+
+typedef LIDAR_Lite_v3_Base B;
+typedef LIDAR_Lite_v3_Snapshot S;
+
+LIDAR_Lite_v3_VerifiedDevice::LIDAR_Lite_v3_VerifiedDevice(LIDAR_Lite_v3_Base &device)
+	: m_device(device), m_intervalNs(0), m_lastNs(0)
+{
+	/* Address lookup so the write path does not search the register table */
+	for (uint16_t a = 0; a < S::SIZE; a++)
+		m_config[a] = false;
+	for (uint8_t i = 0; i < B::REGISTER_COUNT; i++)
+		if (S::isConfig(B::REGISTERS[i]))
+			for (uint16_t a = B::REGISTERS[i].address; a < B::REGISTERS[i].address + B::REGISTERS[i].width / 8; a++)
+				m_config[a] = true;
+	clearReport();
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::record(uint16_t address, uint8_t value)
+{
+	if (address == B::POWER_CONTROL::__address && (value & B::POWER_CONTROL::Sleep::mask))
+		m_pending.clear();
+	else if (address < S::SIZE && m_config[address])
+	{
+		m_pending.set(address, value);
+		m_report.writes++;
+	}
+}
+
+uint8_t LIDAR_Lite_v3_VerifiedDevice::read8(uint16_t address, uint16_t n)
+{
+	uint8_t value = m_device.read8(address, n);
+	confirm(address, value);
+	return value;
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::write(uint16_t address, uint8_t value, uint16_t n)
+{
+	m_device.write(address, value, n);
+	if (address == B::ACQ_COMMAND::__address && value == B::ACQ_COMMAND::ACQ_COMMAND_::RESET)
+		m_pending.clear();
+	else
+		record(address, value);
+}
+
+uint16_t LIDAR_Lite_v3_VerifiedDevice::read16(uint16_t address, uint16_t n)
+{
+	return m_device.read16(address, n);
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::write(uint16_t address, uint16_t value, uint16_t n)
+{
+	m_device.write(address, value, n);
+	record(address, (uint8_t)(value >> 8));
+	record(address + 1, (uint8_t)value);
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::readBurst(uint16_t address, uint8_t *data, uint16_t count)
+{
+	m_device.readBurst(address, data, count);
+	for (uint16_t i = 0; i < count; i++)
+		confirm(address + i, data[i]);
+}
+
+uint8_t LIDAR_Lite_v3_VerifiedDevice::pending() const
+{
+	uint8_t n = 0;
+	for (uint16_t a = 0; a < S::SIZE; a++)
+		if (m_pending.has(a))
+			n++;
+	return n;
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::confirm(uint16_t address, uint8_t value)
+{
+	if (m_pending.has(address) && m_pending.value(address) == value)
+	{
+		m_report.checked++;
+		m_pending.erase(address);
+	}
+}
+
+bool LIDAR_Lite_v3_VerifiedDevice::check(uint16_t address, uint8_t value, uint16_t *addresses, uint8_t max, uint8_t &mismatches)
+{
+	m_report.checked++;
+	uint8_t expected = m_pending.value(address);
+	if (value == expected)
+	{
+		m_pending.erase(address);
+		return true;
+	}
+	if (mismatches < max)
+		addresses[mismatches] = address;
+	mismatches++;
+	m_report.mismatches++;
+	/* Stays pending until a later read-back confirms the repair */
+	m_device.write(address, expected, 8);
+	m_report.repairs++;
+	return false;
+}
+
+uint8_t LIDAR_Lite_v3_VerifiedDevice::verify(uint16_t *addresses, uint8_t max)
+{
+	if (!pending())
+		return 0;
+	S readback;
+	m_report.bursts += readback.dump(m_device, m_pending);
+	return verify(readback, addresses, max);
+}
+
+uint8_t LIDAR_Lite_v3_VerifiedDevice::verify(const LIDAR_Lite_v3_Snapshot &readback, uint16_t *addresses, uint8_t max)
+{
+	m_report.verifications++;
+	uint8_t mismatches = 0;
+	for (uint16_t a = 0; a < S::SIZE; a++)
+		if (m_pending.has(a) && readback.has(a))
+			check(a, readback.value(a), addresses, max, mismatches);
+	return mismatches;
+}
+
+uint8_t LIDAR_Lite_v3_VerifiedDevice::service(uint64_t now)
+{
+	if (m_intervalNs == 0 || now - m_lastNs < m_intervalNs || !pending())
+		return 0;
+	m_lastNs = now;
+	return verify();
+}
+
+void LIDAR_Lite_v3_VerifiedDevice::clearReport()
+{
+	memset(&m_report, 0, sizeof(m_report));
+}
@@ -0,0 +1,85 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Verify.hpp
+ */
+
+#ifndef LIDAR_LITE_V3_VERIFY_HPP
+#define LIDAR_LITE_V3_VERIFY_HPP
+
+#include "LIDAR-Lite-v3.hpp"
+#include "LIDAR-Lite-v3-Snapshot.hpp"
+#include "LIDAR-Lite-v3-Clock.hpp"
+
+/*
+ * Write verification with deferred read-back, for buses that lose writes.
+ *
+ * Wraps a transport: writes pass straight through as single transactions and the value written to
+ * a configuration register (LIDAR_Lite_v3_Snapshot::isConfig) is remembered as pending. verify()
+ * reads all pending registers back with grouped bursts, repairs mismatches with a rewrite and keeps
+ * repaired registers pending until they read back correctly. A snapshot the application takes
+ * anyway can be checked without bus traffic, and reads of a pending register through this device
+ * confirm it for free; mismatches seen there are left for verify(), so the transport hooks never
+ * write. A RESET command or setting the POWER_CONTROL Sleep bit drops all pending values: reading
+ * a sleeping device back would wake it and reinitialize its registers.
+ */
+class LIDAR_Lite_v3_VerifiedDevice : public LIDAR_Lite_v3_Base
+{
+public:
+	struct Report
+	{
+		uint64_t writes;       // configuration writes recorded
+		uint64_t verifications;
+		uint64_t bursts;       // read-back transactions
+		uint64_t checked;      // register values compared
+		uint64_t mismatches;
+		uint64_t repairs;      // rewrites issued
+	};
+
+	LIDAR_Lite_v3_VerifiedDevice(LIDAR_Lite_v3_Base &device);
+
+	uint8_t read8(uint16_t address, uint16_t n=8);
+	void write(uint16_t address, uint8_t value, uint16_t n=8);
+	uint16_t read16(uint16_t address, uint16_t n=16);
+	void write(uint16_t address, uint16_t value, uint16_t n=16);
+	void readBurst(uint16_t address, uint8_t *data, uint16_t count);
+
+	/* Registers written but not yet confirmed */
+	uint8_t pending() const;
+
+	/*
+	 * Read back the pending registers and repair mismatches. The addresses of mismatching registers
+	 * are stored in addresses (up to max). Returns the number of mismatches.
+	 */
+	uint8_t verify(uint16_t *addresses=0, uint8_t max=0);
+	/* Check the pending registers held by a snapshot read from this device, repairing mismatches */
+	uint8_t verify(const LIDAR_Lite_v3_Snapshot &readback, uint16_t *addresses=0, uint8_t max=0);
+
+	/* verify() at most every intervalNs while registers are pending, 0 disables */
+	void interval(uint64_t intervalNs) { m_intervalNs = intervalNs; }
+	/* Call from the application loop, runs verify() when due. Returns the number of mismatches. */
+	uint8_t service(uint64_t now=LIDAR_Lite_v3_Clock::now());
+
+	Report report() const { return m_report; }
+	void clearReport();
+
+private:
+	void record(uint16_t address, uint8_t value);
+	/* Drop a pending register that read back as written, without repairing */
+	void confirm(uint16_t address, uint8_t value);
+	bool check(uint16_t address, uint8_t value, uint16_t *addresses, uint8_t max, uint8_t &mismatches);
+
+	LIDAR_Lite_v3_Base &m_device;
+	bool m_config[LIDAR_Lite_v3_Snapshot::SIZE];
+	LIDAR_Lite_v3_Snapshot m_pending; // expected values of unconfirmed registers
+	uint64_t m_intervalNs;
+	uint64_t m_lastNs;
+	Report m_report;
+};
+
+#endif /* LIDAR_LITE_V3_VERIFY_HPP */
@@ -11,3 +11,41 @@
 
 #include "LIDAR-Lite-v3.hpp"
 
+
+typedef LIDAR_Lite_v3_Base B;
+typedef LIDAR_Lite_v3_Base::REGISTER_INFO I;
+
+const I B::REGISTERS[B::REGISTER_COUNT] = {
+	{ "ACQ_COMMAND", B::ACQ_COMMAND::__address, 8, I::WRITE | I::VOLATILE, 0 },
+	{ "STATUS", B::STATUS::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "SIG_COUNT_VAL", B::SIG_COUNT_VAL::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::SIG_COUNT_VAL::SIG_COUNT_VAL_::dflt },
+	{ "ACQ_CONFIG_REG", B::ACQ_CONFIG_REG::__address, 8, I::READ | I::WRITE | I::DEFAULT,
+		B::ACQ_CONFIG_REG::unused_0::dflt << 7 | B::ACQ_CONFIG_REG::EnableReferenceProcess::dflt << 6
+		| B::ACQ_CONFIG_REG::Delay::dflt << 5 | B::ACQ_CONFIG_REG::Reference::dflt << 4
+		| B::ACQ_CONFIG_REG::MeasurementQuickTermination::dflt << 3 | B::ACQ_CONFIG_REG::ReferenceAcquisition::dflt << 2
+		| B::ACQ_CONFIG_REG::ModeSelectPinFunctionControl::dflt },
+	{ "VELOCITY", B::VELOCITY::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "PEAK_CORR", B::PEAK_CORR::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "NOISE_PEAK", B::NOISE_PEAK::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "SIGNAL_STRENGTH", B::SIGNAL_STRENGTH::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "FULL_DELAY", B::FULL_DELAY::__address, 16, I::READ | I::VOLATILE, 0 },
+	{ "OUTER_LOOP_COUNT", B::OUTER_LOOP_COUNT::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::OUTER_LOOP_COUNT::Value::dflt },
+	{ "REF_COUNT_VAL", B::REF_COUNT_VAL::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::REF_COUNT_VAL::Value::dflt },
+	{ "LAST_DELAY_HIGH", B::LAST_DELAY_HIGH::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "LAST_DELAY_LOW", B::LAST_DELAY_LOW::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "UNIT_ID_HIGH", B::UNIT_ID_HIGH::__address, 8, I::READ, 0 },
+	{ "UNIT_ID_LOW", B::UNIT_ID_LOW::__address, 8, I::READ, 0 },
+	{ "I2C_ID_HIGH", B::I2C_ID_HIGH::__address, 8, I::WRITE, 0 },
+	{ "I2C_ID_LOW", B::I2C_ID_LOW::__address, 8, I::WRITE, 0 },
+	{ "I2C_SEC_ADDR", B::I2C_SEC_ADDR::__address, 8, I::WRITE, 0 },
+	{ "THRESHOLD_BYPASS", B::THRESHOLD_BYPASS::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::THRESHOLD_BYPASS::Value::dflt },
+	{ "I2C_CONFIG", B::I2C_CONFIG::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::I2C_CONFIG::ResponseControl::dflt << 3 },
+	{ "COMMAND", B::COMMAND::__address, 8, I::READ | I::WRITE | I::VOLATILE, 0 },
+	{ "MEASURE_DELAY", B::MEASURE_DELAY::__address, 8, I::READ | I::WRITE | I::DEFAULT, B::MEASURE_DELAY::Value::dflt },
+	{ "PEAK_BCK", B::PEAK_BCK::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "CORR_DATA", B::CORR_DATA::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "CORR_DATA_SIGN", B::CORR_DATA_SIGN::__address, 8, I::READ | I::VOLATILE, 0 },
+	{ "ACQ_SETTINGS", B::ACQ_SETTINGS::__address, 8, I::READ | I::WRITE | I::VOLATILE, 0 },
+	{ "POWER_CONTROL", B::POWER_CONTROL::__address, 8, I::READ | I::WRITE | I::DEFAULT,
+		B::POWER_CONTROL::Sleep::dflt << 2 | B::POWER_CONTROL::ReceiverCircuit::dflt },
+};
@@ -9,6 +9,9 @@
  * file:        LIDAR-Lite-v3.hpp
  */
 
+#ifndef LIDAR_LITE_V3_HPP
+#define LIDAR_LITE_V3_HPP
+
 #include <cinttypes>
 
 /* Derive from class LIDAR_Lite_v3_Base and implement the read and write functions! */
@@ -23,6 +26,13 @@ public:
 	virtual uint16_t read16(uint16_t address, uint16_t n=16) = 0;  // 16 bit read
 	virtual void write(uint16_t address, uint16_t value, uint16_t n=16) = 0;  // 16 bit write
 	
+	/* Burst read of count consecutive 8 bit registers. Override if the bus supports auto-increment (address | 0x80): */
+	virtual void readBurst(uint16_t address, uint8_t *data, uint16_t count)
+	{
+		for (uint16_t i = 0; i < count; i++)
+			data[i] = read8(address + i, 8);
+	}
+	
 	
 	/****************************************************************************************************\
 	 *                                                                                                  *
@@ -1107,4 +1117,44 @@ public:
 		return read8(POWER_CONTROL::__address, 8);
 	}
 	
+	
+	/****************************************************************************************************\
+	 *                                                                                                  *
+	 *                                           REGISTER MAP                                           *
+	 *                                                                                                  *
+	\****************************************************************************************************/
+	
+	/*
+	 * Register metadata, one entry per register in ascending address order.
+	 * Allows iterating over the register map, e.g. for snapshot, diff and restore.
+	 */
+	struct REGISTER_INFO
+	{
+		/* Flags: */
+		static const uint8_t READ = 0b0001; // Readable
+		static const uint8_t WRITE = 0b0010; // Writable
+		static const uint8_t VOLATILE = 0b0100; // Changed by the device or a command, not configuration
+		static const uint8_t DEFAULT = 0b1000; // dflt holds the reset value
+		
+		const char *name;
+		uint16_t address;
+		uint8_t width; // bits
+		uint8_t flags;
+		uint8_t dflt;
+	};
+	
+	static const uint8_t REGISTER_COUNT = 27;
+	static const REGISTER_INFO REGISTERS[REGISTER_COUNT];
+	
+	/* Find the metadata of a register, 0 if the address is not a register */
+	static const REGISTER_INFO *findRegister(uint16_t address)
+	{
+		for (uint8_t i = 0; i < REGISTER_COUNT; i++)
+			if (REGISTERS[i].address == address)
+				return &REGISTERS[i];
+		return 0;
+	}
+	
 };
+
+#endif /* LIDAR_LITE_V3_HPP */
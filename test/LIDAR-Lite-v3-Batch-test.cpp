@@ -0,0 +1,152 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Batch-test.cpp
+ */
+
+/*
+ * Proves that batch acquisition makes no heap allocation after setup: global operator new is
+ * replaced by a counting version and the counter must not move across readBatch().
+ *
+ *   g++ -I. test/LIDAR-Lite-v3-Batch-test.cpp LIDAR-Lite-v3.cpp LIDAR-Lite-v3-Batch.cpp LIDAR-Lite-v3-Trigger.cpp && ./a.out
+ */
+
+#include "LIDAR-Lite-v3-Batch.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+static unsigned long allocations = 0;
+
+void *operator new(size_t size)
+{
+	allocations++;
+	void *p = malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *p) throw()
+{
+	free(p);
+}
+
+void operator delete[](void *p) throw()
+{
+	free(p);
+}
+
+void operator delete(void *p, size_t) throw()
+{
+	free(p);
+}
+
+void operator delete[](void *p, size_t) throw()
+{
+	free(p);
+}
+
+/* Register file in memory, busy for one STATUS poll after every command */
+class FakeDevice : public LIDAR_Lite_v3_Base
+{
+public:
+	FakeDevice() : m_busy(0), m_distance(100)
+	{
+		memset(m_regs, 0, sizeof(m_regs));
+	}
+	virtual ~FakeDevice() {}
+
+	uint8_t read8(uint16_t address, uint16_t)
+	{
+		if (address == STATUS::__address)
+			return m_busy ? (m_busy--, STATUS::BusyFlag::mask | STATUS::HealthFlag::mask) : STATUS::HealthFlag::mask;
+		if (address == SIGNAL_STRENGTH::__address)
+			return 200;
+		return m_regs[address & 0xff];
+	}
+
+	void write(uint16_t address, uint8_t value, uint16_t)
+	{
+		if (address == ACQ_COMMAND::__address && value != ACQ_COMMAND::ACQ_COMMAND_::RESET)
+		{
+			m_busy = 1;
+			m_distance++;
+			return;
+		}
+		m_regs[address & 0xff] = value;
+	}
+
+	uint16_t read16(uint16_t address, uint16_t)
+	{
+		if (address == FULL_DELAY::__address)
+			return m_distance;
+		return (uint16_t)(m_regs[address & 0xff] << 8 | m_regs[(address + 1) & 0xff]);
+	}
+
+	void write(uint16_t address, uint16_t value, uint16_t)
+	{
+		m_regs[address & 0xff] = (uint8_t)(value >> 8);
+		m_regs[(address + 1) & 0xff] = (uint8_t)value;
+	}
+
+private:
+	uint8_t m_regs[256];
+	uint8_t m_busy;
+	uint16_t m_distance;
+};
+
+static int failures = 0;
+
+static void expect(bool condition, const char *what)
+{
+	if (!condition)
+	{
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+int main()
+{
+	/* Setup may allocate */
+	FakeDevice *device = new FakeDevice();
+	LIDAR_Lite_v3_Batch batch(*device, 10);
+	LIDAR_Lite_v3_Measurement out[64];
+	LIDAR_Lite_v3_Ring<LIDAR_Lite_v3_Measurement, 16> ring;
+	LIDAR_Lite_v3_Queue<LIDAR_Lite_v3_Measurement, 16> queue;
+
+	unsigned long before = allocations;
+	size_t n = batch.readBatch(out, 64);
+	size_t r = batch.readBatch(ring, 40);
+	size_t q = batch.readBatch(queue, 40);
+	LIDAR_Lite_v3_Measurement m;
+	while (queue.pop(m))
+		;
+	size_t again = batch.readBatch(queue, 8);
+	unsigned long after = allocations;
+
+	expect(before > 0, "allocation counter active");
+	expect(n == 64, "array batch complete");
+	expect(out[63].distance == out[0].distance + 63, "array batch in order");
+	expect(r == 40 && ring.size() == 16, "ring keeps the newest");
+	expect(ring.back().distance == out[63].distance + 40, "ring newest last");
+	expect(q == 16 && again == 8, "queue stops when full");
+	expect(after == before, "no heap allocation after setup");
+
+	delete device;
+	printf("%s: %lu allocations during acquisition\n", failures ? "FAILED" : "passed", after - before);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-BusQueue-test.cpp
+ */
+
+/*
+ * Ordering guarantees of the transaction queue: every command register write reaches the bus,
+ * configuration writes collapse, and a read never overtakes an older write to its register.
+ *
+ *   g++ -I. test/LIDAR-Lite-v3-BusQueue-test.cpp LIDAR-Lite-v3.cpp LIDAR-Lite-v3-BusQueue.cpp -lpthread && ./a.out
+ */
+
+#include "LIDAR-Lite-v3-BusQueue.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+typedef LIDAR_Lite_v3_BusQueue Q;
+
+/* Register file in memory that logs every write reaching the bus */
+class LoggingDevice : public LIDAR_Lite_v3_Base
+{
+public:
+	static const uint8_t LOG_SIZE = 16;
+
+	LoggingDevice() : m_writes(0)
+	{
+		memset(m_regs, 0, sizeof(m_regs));
+	}
+	virtual ~LoggingDevice() {}
+
+	uint8_t read8(uint16_t address, uint16_t) { return m_regs[address & 0xff]; }
+
+	void write(uint16_t address, uint8_t value, uint16_t)
+	{
+		if (m_writes < LOG_SIZE)
+		{
+			m_address[m_writes] = address;
+			m_value[m_writes] = value;
+		}
+		m_writes++;
+		m_regs[address & 0xff] = value;
+	}
+
+	uint16_t read16(uint16_t address, uint16_t)
+	{
+		return (uint16_t)(m_regs[address & 0xff] << 8 | m_regs[(address + 1) & 0xff]);
+	}
+
+	void write(uint16_t address, uint16_t value, uint16_t n)
+	{
+		write(address, (uint8_t)(value >> 8), n);
+		write(address + 1, (uint8_t)value, n);
+	}
+
+	uint8_t writes() const { return m_writes; }
+	uint16_t address(uint8_t i) const { return m_address[i]; }
+	uint8_t value(uint8_t i) const { return m_value[i]; }
+	void clear() { m_writes = 0; }
+
+private:
+	uint8_t m_regs[256];
+	uint8_t m_writes;
+	uint16_t m_address[LOG_SIZE];
+	uint8_t m_value[LOG_SIZE];
+};
+
+static int failures = 0;
+
+static void expect(bool condition, const char *what)
+{
+	if (!condition)
+	{
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+static void drain(Q &queue)
+{
+	while (queue.pump())
+		;
+}
+
+int main()
+{
+	typedef LIDAR_Lite_v3_Base::ACQ_COMMAND::ACQ_COMMAND_ Command;
+	const uint16_t acqCommand = LIDAR_Lite_v3_Base::ACQ_COMMAND::__address;
+	const uint16_t sigCount = LIDAR_Lite_v3_Base::SIG_COUNT_VAL::__address;
+
+	LoggingDevice device;
+	Q queue(device);
+
+	/* RESET then BIAS: both commands must reach the bus, in order */
+	Q::Handle reset = queue.write(acqCommand, Command::RESET, Q::PRIORITY_CONTROL);
+	Q::Handle bias = queue.write(acqCommand, Command::BIAS, Q::PRIORITY_CONTROL);
+	drain(queue);
+	queue.poll(reset);
+	queue.poll(bias);
+	expect(device.writes() == 2, "RESET and BIAS both written");
+	expect(device.address(0) == acqCommand && device.value(0) == Command::RESET, "RESET first");
+	expect(device.address(1) == acqCommand && device.value(1) == Command::BIAS, "BIAS second");
+	expect(queue.stats().collapsedWrites == 0, "command writes not collapsed");
+
+	/* Configuration writes still collapse to the latest value */
+	device.clear();
+	Q::Handle w1 = queue.write(sigCount, 0x40, Q::PRIORITY_CONFIG);
+	Q::Handle w2 = queue.write(sigCount, 0x80, Q::PRIORITY_CONFIG);
+	drain(queue);
+	queue.poll(w1);
+	queue.poll(w2);
+	expect(device.writes() == 1 && device.value(0) == 0x80, "configuration writes collapsed");
+
+	/* A more urgent read of a register with an older queued write sees the written value */
+	device.clear();
+	Q::Handle w = queue.write(sigCount, 0x22, Q::PRIORITY_DIAGNOSTIC);
+	Q::Handle r = queue.read(sigCount, 1, Q::PRIORITY_DISTANCE);
+	uint8_t data = 0;
+	drain(queue);
+	queue.poll(w);
+	queue.poll(r, &data);
+	expect(data == 0x22, "read after write returns the written value");
+
+	printf("%s\n", failures ? "FAILED" : "passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-LoadGenerator-bench.cpp
+ */
+
+/*
+ * Sweeps growing fleets of simulated sensors through one or all acquisition paths and prints one
+ * table row per run. Faults are injected at a low rate and the target moves, so the numbers include
+ * recovery traffic.
+ *
+ *   g++ -O2 -I. test/LIDAR-Lite-v3-LoadGenerator-bench.cpp LIDAR-Lite-v3*.cpp -lpthread -lrt
+ *   ./a.out [eventloop|scheduler|publisher|all] [secondsPerRun=1] [sensorsPerBus=0: one bus]
+ */
+
+#include "LIDAR-Lite-v3-LoadGenerator.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef LIDAR_Lite_v3_LoadGenerator G;
+
+static const uint16_t SIZES[] = { 1, 4, 16, 64, 256 };
+static const uint8_t SIZE_COUNT = sizeof(SIZES) / sizeof(SIZES[0]);
+
+static void sweep(G &generator, G::Path path, uint64_t durationNs)
+{
+	G::Result results[SIZE_COUNT];
+	uint8_t n = generator.sweep(path, SIZES, SIZE_COUNT, durationNs, results);
+	for (uint8_t i = 0; i < n; i++)
+	{
+		const G::Result &r = results[i];
+		printf("%-9s %7u %5u %10.0f %8.1f %5.2f %8llu %8llu %8llu %6.2f %7u %7llu\n", G::name(path), r.sensors, r.buses,
+			r.hz, r.hzPerSensor, r.busLoad, (unsigned long long)(r.latencyP50Ns / 1000), (unsigned long long)(r.latencyP99Ns / 1000),
+			(unsigned long long)(r.latencyP999Ns / 1000), r.cpuSeconds, r.stateBytes, (unsigned long long)r.residentBytes);
+	}
+	if (n < SIZE_COUNT)
+		printf("%-9s %7u setup failed\n", G::name(path), SIZES[n]);
+}
+
+int main(int argc, char **argv)
+{
+	const char *which = argc > 1 ? argv[1] : "all";
+	double seconds = argc > 2 ? strtod(argv[2], 0) : 1;
+	uint16_t busSize = argc > 3 ? (uint16_t)atoi(argv[3]) : 0;
+	if (!(seconds > 0))
+	{
+		printf("secondsPerRun must be positive\n");
+		return 2;
+	}
+	uint64_t durationNs = (uint64_t)(seconds * 1e9);
+
+	LIDAR_Lite_v3_SimTiming timing = LIDAR_Lite_v3_SimTiming::defaults();
+	LIDAR_Lite_v3_SimFaults faults = { 100, 100, 20 };
+	LIDAR_Lite_v3_SimScript script = LIDAR_Lite_v3_SimScript::constant(300);
+	script.add(500000000ull, 1200);
+	script.periodNs = 1000000000ull;
+
+	G generator(timing, faults, script);
+	generator.busSize(busSize);
+
+	printf("%-9s %7s %5s %10s %8s %5s %8s %8s %8s %6s %7s %7s\n", "path", "sensors", "buses", "hz", "hz/unit", "bus",
+		"p50 us", "p99 us", "p999 us", "cpu s", "state B", "rss B");
+	bool any = false;
+	for (int p = G::EVENT_LOOP; p <= G::PUBLISHER; p++)
+	{
+		G::Path path = (G::Path)p;
+		if (strcmp(which, "all") != 0 && strcmp(which, G::name(path)) != 0)
+			continue;
+		sweep(generator, path, durationNs);
+		any = true;
+	}
+	if (!any)
+	{
+		printf("unknown path %s\n", which);
+		return 2;
+	}
+	return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * name:        LIDAR-Lite-v3
+ * description: A compact, high-performance optical distance measurement sensor from Garmin™.
+ * manuf:       Garmin
+ * version:     0.1
+ * url:         https://static.garmin.com/pumac/LIDAR_Lite_v3_Operation_Manual_and_Technical_Specifications.pdf
+ * date:        2026-10-18
+ * author       https://chisl.io/
+ * file:        LIDAR-Lite-v3-Realtime-bench.cpp
+ */
+
+/*
+ * Wake-up latency and jitter of the real-time runner while every CPU is kept busy by threads that
+ * spin over a cache-sized buffer. The device is simulated with a spinning 400 kHz bus. Reports the
+ * 99.9th percentiles and fails if jitter exceeds the optional limit.
+ *
+ *   g++ -O2 -I. test/LIDAR-Lite-v3-Realtime-bench.cpp LIDAR-Lite-v3.cpp LIDAR-Lite-v3-Trigger.cpp \
+ *       LIDAR-Lite-v3-Snapshot.cpp LIDAR-Lite-v3-Realtime.cpp LIDAR-Lite-v3-Simulator.cpp -lpthread
+ *   sudo ./a.out [seconds=5] [periodUs=1000] [priority=80] [cpu=-1] [limitUs=0]
+ */
+
+#include "LIDAR-Lite-v3-Realtime.hpp"
+#include "LIDAR-Lite-v3-Simulator.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+static const size_t LOAD_BYTES = 4 * 1024 * 1024;
+static const int MAX_LOAD_THREADS = 256;
+
+static int stopLoad = 0;
+
+static void *load(void *arg)
+{
+	volatile uint8_t *buffer = (volatile uint8_t *)arg;
+	for (size_t i = 0; !__atomic_load_n(&stopLoad, __ATOMIC_RELAXED); i = (i + 64) % LOAD_BYTES)
+		buffer[i]++;
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned seconds = argc > 1 ? atoi(argv[1]) : 5;
+	uint64_t periodNs = (argc > 2 ? atoi(argv[2]) : 1000) * 1000ull;
+	int priority = argc > 3 ? atoi(argv[3]) : 80;
+	int cpu = argc > 4 ? atoi(argv[4]) : -1;
+	uint64_t limitNs = (argc > 5 ? atoi(argv[5]) : 0) * 1000ull;
+
+	LIDAR_Lite_v3_SimTiming timing = LIDAR_Lite_v3_SimTiming::defaults();
+	timing.resetNs = 0;
+	timing.spin = true;
+	LIDAR_Lite_v3_SimFaults faults = { 0, 0, 0 };
+	LIDAR_Lite_v3_SimScript script = LIDAR_Lite_v3_SimScript::constant(500);
+	LIDAR_Lite_v3_SimulatedDevice device(timing, faults, script);
+	LIDAR_Lite_v3_RealtimeRunner runner(device, periodNs);
+
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int loadThreads = cpus < 1 ? 1 : cpus > MAX_LOAD_THREADS ? MAX_LOAD_THREADS : (int)cpus;
+	pthread_t threads[MAX_LOAD_THREADS];
+	uint8_t *buffers = (uint8_t *)calloc(loadThreads, LOAD_BYTES);
+	if (!buffers)
+		return 2;
+	for (int i = 0; i < loadThreads; i++)
+		pthread_create(&threads[i], 0, load, buffers + i * LOAD_BYTES);
+
+	bool realtime = runner.start(priority, cpu);
+	if (!realtime)
+	{
+		printf("note: SCHED_FIFO or mlockall refused, running at normal priority\n");
+		if (!runner.start(0, cpu, false))
+			return 2;
+	}
+	sleep(seconds);
+	runner.stop();
+
+	__atomic_store_n(&stopLoad, 1, __ATOMIC_RELAXED);
+	for (int i = 0; i < loadThreads; i++)
+		pthread_join(threads[i], 0);
+	free(buffers);
+
+	LIDAR_Lite_v3_RealtimeRunner::Report r = runner.report();
+	printf("%d load threads, period %llu us, %s\n", loadThreads, (unsigned long long)(periodNs / 1000), realtime ? "SCHED_FIFO" : "SCHED_OTHER");
+	printf("cycles %llu samples %llu notReady %llu overruns %llu skipped %llu\n", (unsigned long long)r.cycles,
+		(unsigned long long)r.samples, (unsigned long long)r.notReady, (unsigned long long)r.overruns, (unsigned long long)r.skippedPeriods);
+	printf("p99.9 wakeup %llu ns, jitter %llu ns (max %llu ns), bus %llu ns\n", (unsigned long long)r.wakeupP999Ns,
+		(unsigned long long)r.jitterP999Ns, (unsigned long long)r.jitterMaxNs, (unsigned long long)r.busP999Ns);
+
+	bool failed = limitNs && r.jitterP999Ns > limitNs;
+	printf("%s\n", failed ? "FAILED: p99.9 jitter above limit" : "passed");
+	return failed ? 1 : 0;
+}